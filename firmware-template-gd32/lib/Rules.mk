@@ -20,7 +20,7 @@ $(info $$ENET_PHY [${ENET_PHY}])
 
 SRCDIR=src src/gd32 $(EXTRA_SRCDIR)
 
-DEFINES:=$(addprefix -D,$(DEFINES)) -DCONFIG_NETWORK_MEMORY_BLOCKS=4
+DEFINES:=$(addprefix -D,$(DEFINES)) -DCONFIG_NETWORK_MEMORY_BLOCKS=4 -DCONFIG_NETWORK_MEMORY_SMALL_BLOCKS=4
 
 include ../common/make/gd32/Board.mk
 include ../common/make/gd32/Mcu.mk
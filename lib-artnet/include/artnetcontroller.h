@@ -46,6 +46,21 @@ struct TArtNetController {
     uint8_t Oem[2];
 };
 
+namespace artnet::controller {
+/*
+ * A frame is the universes sent from the first HandleDmxOut up to HandleSync.
+ */
+struct Counters {
+    uint32_t dmx_frames;        ///< Frames ended by HandleSync
+    uint32_t dmx_packets;       ///< ArtDmx packets, one per destination
+    uint32_t dmx_bytes;         ///< ArtDmx UDP payload bytes
+    uint32_t send_micros;       ///< Time spent in HandleDmxOut for the last frame
+    uint32_t send_micros_max;
+    uint32_t frame_micros;      ///< From the first universe up to the end of the last frame
+    uint32_t frame_micros_max;
+};
+} // namespace artnet::controller
+
 class ArtNetController : public ArtNetPollTable {
    public:
     ArtNetController();
@@ -95,6 +110,8 @@ class ArtNetController : public ArtNetPollTable {
 
     const uint8_t* GetSoftwareVersion();
 
+    const artnet::controller::Counters& GetCounters() const { return counters_; }
+
 #if defined(ARTNET_HAVE_TRIGGER)
     void SetArtTriggerCallbackFunctionPtr(ArtTriggerCallbackFunctionPtr artTriggerCallbackFunctionPtr) { m_ArtTriggerCallbackFunctionPtr = artTriggerCallbackFunctionPtr; }
 #endif
@@ -109,6 +126,8 @@ class ArtNetController : public ArtNetPollTable {
     void HandlePoll(const uint8_t* buffer, uint32_t from_ip);
     void HandlePollReply(const uint8_t* buffer, uint32_t from_ip);
     void HandleTrigger();
+    void CopyDmx(uint8_t* destination, const uint8_t* dmx_data, uint32_t length, uint32_t data_length);
+    void SendDmx(const uint8_t* dmx_data, uint32_t length, uint32_t data_length, uint32_t ip);
     void ActiveUniversesAdd(uint16_t nUniverse);
     void ActiveUniversesClear();
 
@@ -132,6 +151,11 @@ class ArtNetController : public ArtNetPollTable {
 
     ArtTriggerCallbackFunctionPtr m_ArtTriggerCallbackFunctionPtr{nullptr};
 
+    artnet::controller::Counters counters_{};
+    uint32_t frame_start_micros_{0};
+    uint32_t frame_send_micros_{0};
+    bool is_frame_{false};
+
     bool m_bSynchronization{true};
     bool m_bUnicast{true};
     bool m_bForceBroadcast{false};
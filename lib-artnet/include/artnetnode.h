@@ -61,6 +61,7 @@
 #endif
 #include "dmxnode.h"
 #include "dmxnode_outputtype.h"
+#include "dmxnodeportlookup.h"
 #include "artnet_debug.h"
 #include "ip4/ip4_address.h"
 
@@ -129,8 +130,7 @@ struct Source {
 };
 
 struct OutputPort {
-    Source source_a ALIGNED;
-    Source source_b ALIGNED;
+    Source source[dmxnode::kMergeSources] ALIGNED;
     uint32_t rdm_destination_ip;
     uint8_t good_output;
     uint8_t good_output_b;
@@ -333,6 +333,7 @@ class ArtNetNode {
     void HandleTrigger();
 
     void SetPortAddress(uint32_t port_index);
+    void UpdatePortLookup();
 
     void UpdateMergeStatus(uint32_t port_index);
     void CheckMergeTimeouts(uint32_t port_index);
@@ -365,6 +366,7 @@ class ArtNetNode {
     artnetnode::State state_;
     artnetnode::OutputPort output_port_[dmxnode::kMaxPorts];
     artnetnode::InputPort input_port_[dmxnode::kMaxPorts];
+    dmxnode::PortLookup port_lookup_; ///< Port-Address to the Art-Net output ports
 
     artnet::ArtPollReply art_poll_reply_;
 #if defined(ARTNET_HAVE_DMXIN)
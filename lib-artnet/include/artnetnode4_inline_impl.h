@@ -83,6 +83,7 @@ inline void ArtNetNode::SetPortProtocol4(uint32_t port_index, artnet::PortProtoc
     }
 
     node_.port[port_index].protocol = port_protocol;
+    UpdatePortLookup();
 
     if (port_protocol == artnet::PortProtocol::kSacn) {
         if (node_.port[port_index].direction == dmxnode::Direction::kOutput) {
@@ -47,6 +47,7 @@
 
 inline void ArtNetNode::SetPortAddress(uint32_t port_index) {
     node_.port[port_index].port_address = artnet::MakePortAddress(node_.port[port_index].net_switch, node_.port[port_index].sub_switch, node_.port[port_index].sw);
+    UpdatePortLookup();
 }
 
 inline void ArtNetNode::SetOutput(DmxNodeOutputType* dmx_node_output_type) {
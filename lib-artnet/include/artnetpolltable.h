@@ -84,6 +84,8 @@ class ArtNetPollTable {
    private:
     void ProcessUniverse(uint32_t ip_address, uint16_t universe);
     void RemoveIpAddress(uint16_t universe, uint32_t ip_address);
+    uint32_t LowerBoundUniverse(uint16_t universe) const;
+    static uint32_t LowerBoundIpAddress(const artnet::PollTableUniverses& table_universes, uint32_t ip_address);
 
     artnet::NodeEntry* table_;
     artnet::PollTableUniverses* table_universes_;
@@ -42,6 +42,7 @@
 using namespace artnet;
 
 static uint16_t s_active_universes[POLL_TABLE_SIZE_UNIVERSES] __attribute__((aligned(4)));
+static constexpr uint32_t kArtDmxHeaderSize = sizeof(struct ArtDmx) - artnet::kDmxLength;
 
 ArtNetController::ArtNetController() {
     DEBUG_ENTRY();
@@ -244,15 +245,60 @@ void ArtNetController::Stop() {
     DEBUG_EXIT();
 }
 
+/*
+ * The master is applied while copying. The slots up to the (even) data length are padded with zero.
+ */
+void ArtNetController::CopyDmx(uint8_t* destination, const uint8_t* dmx_data, uint32_t length, uint32_t data_length) {
+#if defined(CONFIG_ARTNET_CONTROLLER_ENABLE_MASTER)
+    if (__builtin_expect((master_ == dmxnode::kDmxMaxValue), 1)) {
+#endif
+        memcpy(destination, dmx_data, length);
+#if defined(CONFIG_ARTNET_CONTROLLER_ENABLE_MASTER)
+    } else if (master_ == 0) {
+        memset(destination, 0, length);
+    } else {
+        for (uint32_t i = 0; i < length; i++) {
+            destination[i] = ((master_ * static_cast<uint32_t>(dmx_data[i])) / dmxnode::kDmxMaxValue) & 0xFF;
+        }
+    }
+#endif
+
+    memset(&destination[length], 0, data_length - length);
+}
+
+/*
+ * Single destination: the packet is built in the transmit buffer, there is no intermediate copy.
+ */
+void ArtNetController::SendDmx(const uint8_t* dmx_data, uint32_t length, uint32_t data_length, uint32_t ip) {
+    auto* buffer = network::udp::GetSendBuffer();
+
+    memcpy(buffer, m_pArtDmx, kArtDmxHeaderSize);
+    CopyDmx(&buffer[kArtDmxHeaderSize], dmx_data, length, data_length);
+
+    network::udp::SendBuffer(handle_, kArtDmxHeaderSize + data_length, ip, artnet::kUdpPort);
+}
+
 void ArtNetController::HandleDmxOut(uint16_t nUniverse, const uint8_t* pDmxData, uint32_t nLength, uint8_t nPortIndex) {
     DEBUG_ENTRY();
+    assert(nLength <= artnet::kDmxLength);
+
+    const auto kMicrosStart = timing::Micros();
+
+    if (!is_frame_) {
+        is_frame_ = true;
+        frame_start_micros_ = kMicrosStart;
+        frame_send_micros_ = 0;
+    }
 
     ActiveUniversesAdd(nUniverse);
 
+    // The length should be an even number in the range 2 – 512
+    const auto kDataLength = (nLength < 2) ? 2 : ((nLength + 1U) & ~1U);
+
     m_pArtDmx->physical = nPortIndex & 0xFF;
     m_pArtDmx->port_address = nUniverse;
-    m_pArtDmx->length_hi = static_cast<uint8_t>((nLength & 0xFF00) >> 8);
-    m_pArtDmx->length = static_cast<uint8_t>(nLength & 0xFF);
+    m_pArtDmx->length_hi = static_cast<uint8_t>((kDataLength & 0xFF00) >> 8);
+    m_pArtDmx->length = static_cast<uint8_t>(kDataLength & 0xFF);
 
     // The sequence number is used to ensure that ArtDmx packets are used in the correct order.
     // This field is incremented in the range 0x01 to 0xff to allow the receiving node to resequence packets.
@@ -262,59 +308,78 @@ void ArtNetController::HandleDmxOut(uint16_t nUniverse, const uint8_t* pDmxData,
         m_pArtDmx->sequence = 1;
     }
 
-#if defined(CONFIG_ARTNET_CONTROLLER_ENABLE_MASTER)
-    if (__builtin_expect((master_ == dmxnode::kDmxMaxValue), 1)) {
-#endif
-        memcpy(m_pArtDmx->data, pDmxData, nLength);
-#if defined(CONFIG_ARTNET_CONTROLLER_ENABLE_MASTER)
-    } else if (master_ == 0) {
-        memset(m_pArtDmx->data, 0, nLength);
-    } else {
-        for (uint32_t i = 0; i < nLength; i++) {
-            m_pArtDmx->data[i] = ((master_ * static_cast<uint32_t>(pDmxData[i])) / dmxnode::kDmxMaxValue) & 0xFF;
-        }
-    }
-#endif
-
     uint32_t count = 0;
-    auto IpAddresses = const_cast<struct artnet::PollTableUniverses*>(GetIpAddress(nUniverse));
+    const auto* const kIpAddresses = GetIpAddress(nUniverse);
 
     if (m_bUnicast && !m_bForceBroadcast) {
-        if (IpAddresses != nullptr) {
-            count = IpAddresses->nCount;
+        if (kIpAddresses != nullptr) {
+            count = kIpAddresses->nCount;
         } else {
             DEBUG_EXIT();
             return;
         }
     }
 
+    uint32_t packets = 0;
+
     // If the number of universe subscribers exceeds 40 for a given universe, the transmitting device may broadcast.
 
     if (m_bUnicast && (count <= 40) && !m_bForceBroadcast) {
-        for (uint32_t index = 0; index < count; index++) {
-            network::udp::Send(handle_, reinterpret_cast<const uint8_t*>(m_pArtDmx), sizeof(struct ArtDmx), IpAddresses->pIpAddresses[index], artnet::kUdpPort);
+        if (count == 1) {
+            SendDmx(pDmxData, nLength, kDataLength, kIpAddresses->pIpAddresses[0]);
+        } else if (count > 1) {
+            // The packet is built once and then sent to all destinations
+            CopyDmx(m_pArtDmx->data, pDmxData, nLength, kDataLength);
+
+            for (uint32_t index = 0; index < count; index++) {
+                network::udp::Send(handle_, reinterpret_cast<const uint8_t*>(m_pArtDmx), kArtDmxHeaderSize + kDataLength, kIpAddresses->pIpAddresses[index], artnet::kUdpPort);
+            }
         }
 
+        packets = count;
         m_bDmxHandled = true;
+    } else if (!m_bUnicast || (count > 40) || !m_bForceBroadcast) {
+        SendDmx(pDmxData, nLength, kDataLength, network::GetBroadcastIp());
 
-        DEBUG_EXIT();
-        return;
-    }
-
-    if (!m_bUnicast || (count > 40) || !m_bForceBroadcast) {
-        network::udp::Send(handle_, reinterpret_cast<const uint8_t*>(m_pArtDmx), sizeof(struct ArtDmx), network::GetBroadcastIp(), artnet::kUdpPort);
-
+        packets = 1;
         m_bDmxHandled = true;
     }
 
+    frame_send_micros_ += timing::Micros() - kMicrosStart;
+    counters_.dmx_packets += packets;
+    counters_.dmx_bytes += packets * (kArtDmxHeaderSize + kDataLength);
+
     DEBUG_EXIT();
 }
 
+/*
+ * Ends the frame.
+ */
 void ArtNetController::HandleSync() {
     if (m_bSynchronization && m_bDmxHandled) {
         m_bDmxHandled = false;
         network::udp::Send(handle_, reinterpret_cast<const uint8_t*>(m_pArtSync), sizeof(struct ArtSync), network::GetBroadcastIp(), artnet::kUdpPort);
     }
+
+    if (!is_frame_) {
+        return;
+    }
+
+    is_frame_ = false;
+
+    const auto kFrameMicros = timing::Micros() - frame_start_micros_;
+
+    counters_.dmx_frames++;
+    counters_.send_micros = frame_send_micros_;
+    counters_.frame_micros = kFrameMicros;
+
+    if (frame_send_micros_ > counters_.send_micros_max) {
+        counters_.send_micros_max = frame_send_micros_;
+    }
+
+    if (kFrameMicros > counters_.frame_micros_max) {
+        counters_.frame_micros_max = kFrameMicros;
+    }
 }
 
 void ArtNetController::HandleBlackout() {
@@ -93,139 +93,142 @@ ArtNetPollTable::~ArtNetPollTable() {
     ARTNET_DEBUG_EXIT();
 }
 
-const struct artnet::PollTableUniverses* ArtNetPollTable::GetIpAddress(uint16_t universe) const {
-    if (universes_entries_ == 0) {
-        return nullptr;
-    }
+/*
+ * The table_universes_ entries are sorted on universe, the IP addresses of an entry are sorted on value.
+ */
+uint32_t ArtNetPollTable::LowerBoundUniverse(uint16_t universe) const {
+    uint32_t first = 0;
+    uint32_t count = universes_entries_;
 
-    // FIXME Universe lookup
-    for (uint32_t nEntry = 0; nEntry < universes_entries_; nEntry++) {
-        artnet::PollTableUniverses* pTableUniverses = &table_universes_[nEntry];
-        assert(pTableUniverses != nullptr);
+    while (count > 0) {
+        const auto kStep = count / 2;
+        const auto kMiddle = first + kStep;
 
-        if (pTableUniverses->universe == universe) {
-            return &table_universes_[nEntry];
+        if (table_universes_[kMiddle].universe < universe) {
+            first = kMiddle + 1;
+            count -= kStep + 1;
+        } else {
+            count = kStep;
         }
     }
 
-    return nullptr;
+    return first;
 }
 
-void ArtNetPollTable::RemoveIpAddress(uint16_t universe, uint32_t nIpAddress) {
-    if (universes_entries_ == 0) {
-        return;
-    }
-
-    uint32_t nEntry = 0;
+uint32_t ArtNetPollTable::LowerBoundIpAddress(const artnet::PollTableUniverses& table_universes, uint32_t ip_address) {
+    uint32_t first = 0;
+    uint32_t count = table_universes.nCount;
 
-    // FIXME Universe lookup
-    for (nEntry = 0; nEntry < universes_entries_; nEntry++) {
-        artnet::PollTableUniverses* pTableUniverses = &table_universes_[nEntry];
-        assert(pTableUniverses != nullptr);
+    while (count > 0) {
+        const auto kStep = count / 2;
+        const auto kMiddle = first + kStep;
 
-        if (pTableUniverses->universe == universe) {
-            break;
+        if (table_universes.pIpAddresses[kMiddle] < ip_address) {
+            first = kMiddle + 1;
+            count -= kStep + 1;
+        } else {
+            count = kStep;
         }
     }
 
-    if (nEntry == universes_entries_) {
-        // Universe not found
-        return;
+    return first;
+}
+
+const struct artnet::PollTableUniverses* ArtNetPollTable::GetIpAddress(uint16_t universe) const {
+    const auto kEntry = LowerBoundUniverse(universe);
+
+    if ((kEntry < universes_entries_) && (table_universes_[kEntry].universe == universe)) {
+        return &table_universes_[kEntry];
     }
 
-    artnet::PollTableUniverses* pTableUniverses = &table_universes_[nEntry];
-    assert(pTableUniverses->nCount > 0);
+    return nullptr;
+}
 
-    uint32_t nIpAddressIndex = 0;
+void ArtNetPollTable::RemoveIpAddress(uint16_t universe, uint32_t ip_address) {
+    const auto kEntry = LowerBoundUniverse(universe);
 
-    // FIXME IP lookup
-    for (nIpAddressIndex = 0; nIpAddressIndex < pTableUniverses->nCount; nIpAddressIndex++) {
-        if (pTableUniverses->pIpAddresses[nIpAddressIndex] == nIpAddress) {
-            break;
-        }
+    if ((kEntry == universes_entries_) || (table_universes_[kEntry].universe != universe)) {
+        // Universe not found
+        return;
     }
 
-    auto* p32 = pTableUniverses->pIpAddresses;
-    int32_t i;
+    auto& table_universes = table_universes_[kEntry];
+    assert(table_universes.nCount > 0);
 
-    for (i = static_cast<int32_t>(nIpAddressIndex); i < static_cast<int32_t>(pTableUniverses->nCount) - 1; i++) {
-        p32[i] = p32[i + 1];
-    }
+    const auto kIndex = LowerBoundIpAddress(table_universes, ip_address);
 
-    p32[i] = 0;
+    if ((kIndex == table_universes.nCount) || (table_universes.pIpAddresses[kIndex] != ip_address)) {
+        return;
+    }
 
-    pTableUniverses->nCount--;
+    auto* ip_addresses = table_universes.pIpAddresses;
+    memmove(&ip_addresses[kIndex], &ip_addresses[kIndex + 1], (table_universes.nCount - kIndex - 1U) * sizeof(uint32_t));
 
-    if (pTableUniverses->nCount == 0) {
-        ARTNET_DEBUG_PRINTF("Delete Universe -> universes_entries_=%u, nEntry=%u", universes_entries_, nEntry);
+    table_universes.nCount--;
 
-        artnet::PollTableUniverses* p = table_universes_;
+    if (table_universes.nCount == 0) {
+        ARTNET_DEBUG_PRINTF("Delete Universe -> universes_entries_=%u, nEntry=%u", universes_entries_, kEntry);
 
-        for (i = static_cast<int32_t>(nEntry); i < static_cast<int32_t>(universes_entries_) - 1; i++) {
-            p[i].universe = p[i + 1].universe;
-            p[i].nCount = p[i + 1].nCount;
-            p[i].pIpAddresses = p[i + 1].pIpAddresses;
+        // The IP address buffer moves to the free entry at the end
+        for (auto i = kEntry; i < (universes_entries_ - 1U); i++) {
+            table_universes_[i].universe = table_universes_[i + 1].universe;
+            table_universes_[i].nCount = table_universes_[i + 1].nCount;
+            table_universes_[i].pIpAddresses = table_universes_[i + 1].pIpAddresses;
         }
 
-        p[i].universe = 0;
-        p[i].nCount = 0;
-
         universes_entries_--;
+
+        table_universes_[universes_entries_].universe = 0;
+        table_universes_[universes_entries_].nCount = 0;
+        table_universes_[universes_entries_].pIpAddresses = ip_addresses;
     }
 }
 
-void ArtNetPollTable::ProcessUniverse(const uint32_t nIpAddress, const uint16_t universe) {
+void ArtNetPollTable::ProcessUniverse(const uint32_t ip_address, const uint16_t universe) {
     ARTNET_DEBUG_ENTRY();
 
-    if (artnet::POLL_TABLE_SIZE_UNIVERSES == universes_entries_) {
-        ARTNET_DEBUG_PUTS("table_universes_ is full");
-        ARTNET_DEBUG_EXIT();
-        return;
-    }
+    const auto kEntry = LowerBoundUniverse(universe);
 
-    // FIXME Universe lookup
-    auto bFoundUniverse = false;
-    uint32_t nEntry = 0;
+    if ((kEntry == universes_entries_) || (table_universes_[kEntry].universe != universe)) {
+        if (artnet::POLL_TABLE_SIZE_UNIVERSES == universes_entries_) {
+            ARTNET_DEBUG_PUTS("table_universes_ is full");
+            ARTNET_DEBUG_EXIT();
+            return;
+        }
 
-    for (nEntry = 0; nEntry < universes_entries_; nEntry++) {
-        auto* pTableUniverses = &table_universes_[nEntry];
-        assert(pTableUniverses != nullptr);
+        // New universe, it takes the IP address buffer of the free entry at the end
+        auto* ip_addresses = table_universes_[universes_entries_].pIpAddresses;
 
-        if (pTableUniverses->universe == universe) {
-            bFoundUniverse = true;
-            ARTNET_DEBUG_PRINTF("Universe found %u", universe);
-            break;
+        for (auto i = universes_entries_; i > kEntry; i--) {
+            table_universes_[i].universe = table_universes_[i - 1].universe;
+            table_universes_[i].nCount = table_universes_[i - 1].nCount;
+            table_universes_[i].pIpAddresses = table_universes_[i - 1].pIpAddresses;
         }
-    }
 
-    auto* pTableUniverses = &table_universes_[nEntry];
-    auto bFoundIp = false;
-    uint32_t nCount = 0;
-
-    if (bFoundUniverse) {
-        // FIXME IP lookup
-        for (nCount = 0; nCount < pTableUniverses->nCount; nCount++) {
-            if (pTableUniverses->pIpAddresses[nCount] == nIpAddress) {
-                bFoundIp = true;
-                ARTNET_DEBUG_PUTS("IP found");
-                break;
-            }
-        }
-    } else {
-        // New universe
-        pTableUniverses->universe = universe;
+        table_universes_[kEntry].universe = universe;
+        table_universes_[kEntry].nCount = 0;
+        table_universes_[kEntry].pIpAddresses = ip_addresses;
         universes_entries_++;
         ARTNET_DEBUG_PRINTF("New Universe %d", static_cast<int>(universe));
     }
 
-    if (!bFoundIp) {
-        if (pTableUniverses->nCount < artnet::POLL_TABLE_SIZE_ENRIES) {
-            pTableUniverses->pIpAddresses[pTableUniverses->nCount] = nIpAddress;
-            pTableUniverses->nCount++;
-            ARTNET_DEBUG_PUTS("It is a new IP for the Universe");
-        } else {
-            ARTNET_DEBUG_PUTS("New IP does not fit");
-        }
+    auto& table_universes = table_universes_[kEntry];
+    const auto kIndex = LowerBoundIpAddress(table_universes, ip_address);
+
+    if ((kIndex < table_universes.nCount) && (table_universes.pIpAddresses[kIndex] == ip_address)) {
+        ARTNET_DEBUG_PUTS("IP found");
+        ARTNET_DEBUG_EXIT();
+        return;
+    }
+
+    if (table_universes.nCount < artnet::POLL_TABLE_SIZE_ENRIES) {
+        auto* ip_addresses = table_universes.pIpAddresses;
+        memmove(&ip_addresses[kIndex + 1], &ip_addresses[kIndex], (table_universes.nCount - kIndex) * sizeof(uint32_t));
+        ip_addresses[kIndex] = ip_address;
+        table_universes.nCount++;
+        ARTNET_DEBUG_PUTS("It is a new IP for the Universe");
+    } else {
+        ARTNET_DEBUG_PUTS("New IP does not fit");
     }
 
     ARTNET_DEBUG_EXIT();
@@ -0,0 +1,43 @@
+/**
+ * @file json_status_artnetcontroller.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+
+#include "artnetcontroller.h"
+
+namespace json::status {
+uint32_t ArtNetController(char* out_buffer, uint32_t out_buffer_size) {
+    const auto& counters = ::ArtNetController::Get()->GetCounters();
+
+    const auto kLength = static_cast<uint32_t>(snprintf(out_buffer, out_buffer_size,
+		"{\"frames\":%u,\"packets\":%u,\"bytes\":%u,\"send_micros\":%u,\"send_micros_max\":%u,\"frame_micros\":%u,\"frame_micros_max\":%u}",
+		static_cast<unsigned>(counters.dmx_frames), static_cast<unsigned>(counters.dmx_packets), static_cast<unsigned>(counters.dmx_bytes),
+		static_cast<unsigned>(counters.send_micros), static_cast<unsigned>(counters.send_micros_max),
+		static_cast<unsigned>(counters.frame_micros), static_cast<unsigned>(counters.frame_micros_max)));
+
+    return (kLength < out_buffer_size) ? kLength : 0;
+}
+} // namespace json::status
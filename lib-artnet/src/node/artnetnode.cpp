@@ -119,8 +119,9 @@ ArtNetNode::ArtNetNode() {
         SetShortName(port_index, nullptr);
         //
         memset(&output_port_[port_index], 0, sizeof(struct artnetnode::OutputPort));
-        output_port_[port_index].source_a.physical = 0x100;
-        output_port_[port_index].source_b.physical = 0x100;
+        for (auto& source : output_port_[port_index].source) {
+            source.physical = 0x100;
+        }
         output_port_[port_index].good_output_b = artnet::GoodOutputB::kRdmDisabled | artnet::GoodOutputB::kDiscoveryNotRunning;
         memset(&input_port_[port_index], 0, sizeof(struct artnetnode::InputPort));
     }
@@ -352,13 +353,11 @@ void ArtNetNode::SetLocalMerging() {
                          artnet::GetProtocolMode(node_.port[output_port_index].protocol), node_.port[output_port_index].port_address);
 
             if ((node_.port[input_port_index].protocol == node_.port[output_port_index].protocol) && (node_.port[input_port_index].port_address == node_.port[output_port_index].port_address)) {
-                if (!node_.port[output_port_index].local_merge) {
-                    output_port_[output_port_index].source_a.ip = network::kIpaddrLoopback;
-                    ARTNET_DEBUG_PUTS("Local merge Source A");
-                } else {
-                    output_port_[output_port_index].source_b.ip = network::kIpaddrLoopback;
-                    ARTNET_DEBUG_PUTS("Local merge Source B");
-                }
+                // The loopback ArtDmx carries the input port index as physical
+                auto& source = output_port_[output_port_index].source[node_.port[output_port_index].local_merge ? 1 : 0];
+                source.ip = network::kIpaddrLoopback;
+                source.physical = static_cast<uint16_t>(input_port_index);
+                ARTNET_DEBUG_PRINTF("Local merge Source %u", node_.port[output_port_index].local_merge ? 1U : 0U);
 
                 node_.port[input_port_index].local_merge = true;
                 node_.port[output_port_index].local_merge = true;
@@ -373,6 +372,16 @@ void ArtNetNode::SetLocalMerging() {
     ARTNET_DEBUG_EXIT();
 }
 
+void ArtNetNode::UpdatePortLookup() {
+    port_lookup_.Clear();
+
+    for (uint32_t port_index = 0; port_index < dmxnode::kMaxPorts; port_index++) {
+        if ((node_.port[port_index].direction == dmxnode::Direction::kOutput) && (node_.port[port_index].protocol == artnet::PortProtocol::kArtnet)) {
+            port_lookup_.Add(port_index, node_.port[port_index].port_address);
+        }
+    }
+}
+
 void ArtNetNode::SetUniverse(uint32_t port_index, uint16_t universe) {
     ARTNET_DEBUG_ENTRY();
     ARTNET_DEBUG_PRINTF("port_index=%u, universe=%u", port_index, universe);
@@ -388,6 +397,7 @@ void ArtNetNode::SetUniverse(uint32_t port_index, uint16_t universe) {
     node_.port[port_index].net_switch = (universe >> 8) & 0x7F;
     node_.port[port_index].sub_switch = (universe >> 4) & 0x0F;
     node_.port[port_index].port_address = universe;
+    UpdatePortLookup();
 
 #if (ARTNET_VERSION >= 4)
     SetUniverse4(port_index);
@@ -456,6 +466,8 @@ void ArtNetNode::SetDirection(uint32_t port_index, dmxnode::Direction port_direc
         node_.port[port_index].direction = dmxnode::Direction::kOutput;
     }
 
+    UpdatePortLookup();
+
     if (state_.status == artnet::Status::kOn) {
         artnet::store::SaveDirection(port_index, port_direction);
 #if defined(ARTNET_HAVE_DMXIN)
@@ -594,7 +606,9 @@ void ArtNetNode::SetNetworkDataLossCondition() {
             continue;
         }
 #endif
-        ip_count += (output_port_[port_index].source_a.ip + output_port_[port_index].source_b.ip);
+        for (const auto& source : output_port_[port_index].source) {
+            ip_count += source.ip;
+        }
         if (ip_count != 0) {
             break;
         }
@@ -628,8 +642,9 @@ void ArtNetNode::SetNetworkDataLossCondition() {
     }
 
     for (uint32_t i = 0; i < dmxnode::kMaxPorts; i++) {
-        output_port_[i].source_a.ip = 0;
-        output_port_[i].source_b.ip = 0;
+        for (auto& source : output_port_[i].source) {
+            source.ip = 0;
+        }
         dmxnode::Data::ClearLength(i);
     }
 
@@ -875,18 +890,27 @@ void ArtNetNode::UpdateMergeStatus(uint32_t port_index) {
 }
 
 void ArtNetNode::CheckMergeTimeouts(uint32_t port_index) {
-    const auto kTimeOutAMillis = current_millis_ - output_port_[port_index].source_a.millis;
+    auto& output_port = output_port_[port_index];
+    uint32_t sources_active = 0;
 
-    if (kTimeOutAMillis > (artnet::kMergeTimeoutSeconds * 1000U)) {
-        output_port_[port_index].source_a.ip = 0;
-        output_port_[port_index].good_output &= static_cast<uint8_t>(~artnet::GoodOutput::kOutputIsMerging);
-    }
+    for (uint32_t source_index = 0; source_index < dmxnode::kMergeSources; source_index++) {
+        auto& source = output_port.source[source_index];
 
-    const auto kTimeOutBMillis = current_millis_ - output_port_[port_index].source_b.millis;
+        if (source.ip == 0) {
+            continue;
+        }
+
+        if ((current_millis_ - source.millis) > (artnet::kMergeTimeoutSeconds * 1000U)) {
+            source.ip = 0;
+            dmxnode::Data::ReleaseSource(port_index, source_index, GetMergeMode(port_index));
+            continue;
+        }
 
-    if (kTimeOutBMillis > (artnet::kMergeTimeoutSeconds * 1000U)) {
-        output_port_[port_index].source_b.ip = 0;
-        output_port_[port_index].good_output &= static_cast<uint8_t>(~artnet::GoodOutput::kOutputIsMerging);
+        sources_active++;
+    }
+
+    if (sources_active < 2) {
+        output_port.good_output &= static_cast<uint8_t>(~artnet::GoodOutput::kOutputIsMerging);
     }
 
     auto is_merging = false;
@@ -905,14 +929,12 @@ void ArtNetNode::CheckMergeTimeouts(uint32_t port_index) {
 void ArtNetNode::HandleDmx() {
     const auto* const kArtDmx = reinterpret_cast<artnet::ArtDmx*>(receive_buffer_);
 
-    for (uint32_t port_index = 0; port_index < dmxnode::kMaxPorts; port_index++) {
+    for (auto ports = port_lookup_.Find(kArtDmx->port_address); ports != 0; ports &= (ports - 1)) {
+        const auto port_index = dmxnode::PortLookup::PortIndex(ports);
 #if defined(RDM_CONTROLLER)
         if (rdm_controller_.IsRunning(port_index)) [[unlikely]]
             continue;
 #endif
-        if (node_.port[port_index].direction != dmxnode::Direction::kOutput) continue;
-        if (node_.port[port_index].protocol != artnet::PortProtocol::kArtnet) continue;
-        if (node_.port[port_index].port_address != kArtDmx->port_address) continue;
 
         output_port_[port_index].good_output |= artnet::GoodOutput::kDataIsBeingTransmitted;
 
@@ -923,121 +945,63 @@ void ArtNetNode::HandleDmx() {
         }
 
         const auto kDmxSlots = std::min(static_cast<uint32_t>(((kArtDmx->length_hi << 8) & 0xff00) | kArtDmx->length), artnet::kDmxLength);
-        const auto kIpA = output_port_[port_index].source_a.ip;
-        const auto kIpB = output_port_[port_index].source_b.ip;
-        const auto kMergeMode = ((output_port_[port_index].good_output & artnet::GoodOutput::kMergeModeLtp) == artnet::GoodOutput::kMergeModeLtp) ? dmxnode::MergeMode::kLtp : dmxnode::MergeMode::kHtp;
-
-        if (__builtin_expect((kIpA == 0 && kIpB == 0), 0)) { // Case 1.
-            output_port_[port_index].source_a.ip = ip_address_from_;
-            output_port_[port_index].source_a.millis = current_millis_;
-            output_port_[port_index].source_a.physical = kArtDmx->physical;
-            dmxnode::Data::SetSourceA(port_index, kArtDmx->data, kDmxSlots);
-            SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u 1. First packet", port_index, kArtDmx->physical);
-        } else if (kIpA == ip_address_from_ && kIpB == 0) { // Case 2.
-            if (output_port_[port_index].source_a.physical == kArtDmx->physical) {
-                output_port_[port_index].source_a.millis = current_millis_;
-                dmxnode::Data::SetSourceA(port_index, kArtDmx->data, kDmxSlots);
-                SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u 2. continued transmission from the same ip (source A)", port_index, kArtDmx->physical);
-            } else if (output_port_[port_index].source_b.physical != kArtDmx->physical) {
-                output_port_[port_index].source_b.ip = ip_address_from_;
-                output_port_[port_index].source_b.millis = current_millis_;
-                output_port_[port_index].source_b.physical = kArtDmx->physical;
-                UpdateMergeStatus(port_index);
-                dmxnode::Data::MergeSourceB(port_index, kArtDmx->data, kDmxSlots, kMergeMode);
-                SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u 2. New source from same ip (source B), start the merge", port_index, kArtDmx->physical);
-            } else {
-                SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u 2. More than two sources, discarding data", port_index, kArtDmx->physical);
-                return;
-            }
-        } else if (kIpA == 0 && kIpB == ip_address_from_) { // Case 3.
-            if (output_port_[port_index].source_b.physical == kArtDmx->physical) {
-                output_port_[port_index].source_b.millis = current_millis_;
-                dmxnode::Data::SetSourceB(port_index, kArtDmx->data, kDmxSlots);
-                SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u 3. continued transmission from the same ip (source B)", port_index, kArtDmx->physical);
-            } else if (output_port_[port_index].source_a.physical != kArtDmx->physical) {
-                output_port_[port_index].source_a.ip = ip_address_from_;
-                output_port_[port_index].source_a.millis = current_millis_;
-                output_port_[port_index].source_a.physical = kArtDmx->physical;
-                UpdateMergeStatus(port_index);
-                dmxnode::Data::MergeSourceA(port_index, kArtDmx->data, kDmxSlots, kMergeMode);
-                SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u 3. New source from same ip (source A), start the merge", port_index, kArtDmx->physical);
-            } else {
-                SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u 3. More than two sources, discarding data", port_index, kArtDmx->physical);
-                return;
-            }
-        } else if (kIpA != ip_address_from_ && kIpB == 0) { // Case 4.
-            output_port_[port_index].source_b.ip = ip_address_from_;
-            output_port_[port_index].source_b.millis = current_millis_;
-            output_port_[port_index].source_b.physical = kArtDmx->physical;
-            UpdateMergeStatus(port_index);
-            dmxnode::Data::MergeSourceB(port_index, kArtDmx->data, kDmxSlots, kMergeMode);
-            SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u 4. new source, start the merge", port_index, kArtDmx->physical);
-        } else if (kIpA == 0 && kIpB != ip_address_from_) { // Case 5.
-            output_port_[port_index].source_a.ip = ip_address_from_;
-            output_port_[port_index].source_a.millis = current_millis_;
-            output_port_[port_index].source_a.physical = kArtDmx->physical;
-            UpdateMergeStatus(port_index);
-            dmxnode::Data::MergeSourceA(port_index, kArtDmx->data, kDmxSlots, kMergeMode);
-            SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u 5. new source, start the merge", port_index, kArtDmx->physical);
-        } else if (kIpA == ip_address_from_ && kIpB != ip_address_from_) { // Case 6.
-            if (output_port_[port_index].source_a.physical == kArtDmx->physical) {
-                output_port_[port_index].source_a.millis = current_millis_;
-                UpdateMergeStatus(port_index);
-                dmxnode::Data::MergeSourceA(port_index, kArtDmx->data, kDmxSlots, kMergeMode);
-                SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u 6. continue merge (Source A)", port_index, kArtDmx->physical);
-            } else {
-                SendDiag(artnet::PriorityCodes::kDiagMed, "%u:%u 6. More than two sources, discarding data", port_index, kArtDmx->physical);
-                return;
+        auto& output_port = output_port_[port_index];
+        auto source_index = dmxnode::kMergeSources;
+        auto source_free = dmxnode::kMergeSources;
+        uint32_t sources_active = 0;
+
+        for (uint32_t i = 0; i < dmxnode::kMergeSources; i++) {
+            const auto& source = output_port.source[i];
+
+            if (source.ip == 0) {
+                if (source_free == dmxnode::kMergeSources) {
+                    source_free = i;
+                }
+                continue;
             }
-        } else if (kIpA != ip_address_from_ && kIpB == ip_address_from_) { // Case 7.
-            if (output_port_[port_index].source_b.physical == kArtDmx->physical) {
-                output_port_[port_index].source_b.millis = current_millis_;
-                UpdateMergeStatus(port_index);
-                dmxnode::Data::MergeSourceB(port_index, kArtDmx->data, kDmxSlots, kMergeMode);
-                SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u 7. continue merge (Source B)", port_index, kArtDmx->physical);
-            } else {
-                SendDiag(artnet::PriorityCodes::kDiagMed, "%u:%u 7. More than two sources, discarding data", port_index, kArtDmx->physical);
-                puts("WARN: 7. More than two sources, discarding data");
-                return;
+
+            sources_active++;
+
+            if ((source.ip == ip_address_from_) && (source.physical == kArtDmx->physical)) {
+                source_index = i;
             }
-        } else if (kIpA == ip_address_from_ && kIpB == ip_address_from_) { // Case 8.
-            if (output_port_[port_index].source_a.physical == kArtDmx->physical) {
-                output_port_[port_index].source_a.millis = current_millis_;
-                UpdateMergeStatus(port_index);
-                dmxnode::Data::MergeSourceA(port_index, kArtDmx->data, kDmxSlots, kMergeMode);
-                SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u 8. Source matches both ip, merging Physical (source_a)", port_index, kArtDmx->physical);
-            } else if (output_port_[port_index].source_b.physical == kArtDmx->physical) {
-                output_port_[port_index].source_b.millis = current_millis_;
-                UpdateMergeStatus(port_index);
-                dmxnode::Data::MergeSourceB(port_index, kArtDmx->data, kDmxSlots, kMergeMode);
-                SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u 8. Source matches both ip, merging Physical (source_b)", port_index, kArtDmx->physical);
-            } else {
-                SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u 8. Source matches both ip, more than two sources, discarding data", port_index, kArtDmx->physical);
-                puts("WARN: 8. Source matches both ip, discarding data");
+        }
+
+        if (source_index == dmxnode::kMergeSources) {
+            if (source_free == dmxnode::kMergeSources) [[unlikely]] {
+                SendDiag(artnet::PriorityCodes::kDiagMed, "%u:%u More than %u sources, discarding data", port_index, kArtDmx->physical, dmxnode::kMergeSources);
                 return;
             }
+
+            source_index = source_free;
+            output_port.source[source_index].ip = ip_address_from_;
+            output_port.source[source_index].physical = kArtDmx->physical;
+            sources_active++;
+            SendDiag(artnet::PriorityCodes::kDiagLow, "%u:%u New source %u", port_index, kArtDmx->physical, source_index);
         }
-#ifndef NDEBUG
-        else if (kIpA != ip_address_from_ && kIpB != ip_address_from_) { // Case 9.
-            SendDiag(artnet::PriorityCodes::kDiagLow, "%u: 9. More than two sources, discarding data", port_index);
-            puts("WARN: 9. More than two sources, discarding data");
-            return;
+
+        output_port.source[source_index].millis = current_millis_;
+
+        if (sources_active != 1) {
+            UpdateMergeStatus(port_index);
         }
-#endif
-        else [[unlikely]] { // Case 0.
-            SendDiag(artnet::PriorityCodes::kDiagHigh, "%u: 0. No cases matched, this shouldn't happen!", port_index);
-#ifndef NDEBUG
-            puts("ERROR: 0. No cases matched, this shouldn't happen!");
-#endif
-            return;
+
+        const auto kIsBuffering = (state_.is_synchronous_mode) && ((output_port_[port_index].good_output & artnet::GoodOutput::kOutputIsMerging) != artnet::GoodOutput::kOutputIsMerging);
+        // Without sync the merge writes straight into the transmit buffer of the output
+        auto* transmit = kIsBuffering ? nullptr : dmxnode::DataTransmitBuffer(dmxnode_output_type_, port_index);
+
+        if (sources_active == 1) {
+            dmxnode::Data::SetSource(port_index, source_index, kArtDmx->data, kDmxSlots, transmit);
+        } else {
+            dmxnode::Data::MergeSource(port_index, source_index, kArtDmx->data, kDmxSlots, GetMergeMode(port_index), transmit);
         }
 
-        if ((state_.is_synchronous_mode) && ((output_port_[port_index].good_output & artnet::GoodOutput::kOutputIsMerging) != artnet::GoodOutput::kOutputIsMerging)) {
+        if (kIsBuffering) {
             dmxnode::DataSet(dmxnode_output_type_, port_index);
             output_port_[port_index].is_data_pending = true;
             SendDiag(artnet::PriorityCodes::kDiagLow, "%u: Buffering data", port_index);
         } else {
-            dmxnode::DataOutput(dmxnode_output_type_, port_index);
+            dmxnode::DataOutput(dmxnode_output_type_, port_index, transmit);
 
             if (!output_port_[port_index].is_transmitting) {
                 dmxnode_output_type_->Start(port_index);
@@ -1063,7 +1027,8 @@ void ArtNetNode::HandleSync() {
         return;
     }
 
-    for (uint32_t port_index = 0; port_index < dmxnode::kMaxPorts; port_index++) {
+    for (auto ports = port_lookup_.Ports(); ports != 0; ports &= (ports - 1)) {
+        const auto port_index = dmxnode::PortLookup::PortIndex(ports);
         if (output_port_[port_index].is_data_pending) {
             dmxnode_output_type_->Sync(port_index);
             SendDiag(artnet::PriorityCodes::kDiagLow, "Sync individual %u", port_index);
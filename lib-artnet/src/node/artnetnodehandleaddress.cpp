@@ -145,8 +145,9 @@ void ArtNetNode::HandleAddress() {
         case artnet::PortCommand::kCancel:
             state_.is_merge_mode = false;
             for (uint32_t port_index = 0; port_index < dmxnode::kMaxPorts; port_index++) {
-                output_port_[port_index].source_a.ip = 0;
-                output_port_[port_index].source_b.ip = 0;
+                for (auto& source : output_port_[port_index].source) {
+                    source.ip = 0;
+                }
                 output_port_[port_index].good_output &= static_cast<uint8_t>(~artnet::GoodOutput::kOutputIsMerging);
             }
             break;
@@ -39,6 +39,8 @@
 #include "artnet_debug.h"
 
 namespace rdm::discovery {
+static uint32_t s_tod_generation[dmxnode::kMaxPorts];
+
 void Starting(uint32_t port_index, [[maybe_unused]] Type type) {
     ARTNET_RDM_DEBUG_PRINTF("%u:%c", static_cast<unsigned>(port_index), type == rdm::discovery::Type::kFull ? 'F' : 'I');
 
@@ -46,10 +48,18 @@ void Starting(uint32_t port_index, [[maybe_unused]] Type type) {
     artnet.StopOutputPort(port_index);
 }
 
-void Finished(uint32_t port_index, [[maybe_unused]] Type type) {
+void Finished(uint32_t port_index, Type type) {
     ARTNET_RDM_DEBUG_PRINTF("%u:%c", static_cast<unsigned>(port_index), type == rdm::discovery::Type::kFull ? 'F' : 'I');
 
     auto& artnet = *ArtNetNode::Get();
+    const auto kGeneration = rdm::Discovery::Instance().TodGeneration(port_index);
+
+    // An incremental discovery that did not change the TOD is not reported
+    if ((type == rdm::discovery::Type::kIncremental) && (kGeneration == s_tod_generation[port_index])) {
+        return;
+    }
+
+    s_tod_generation[port_index] = kGeneration;
     artnet.SendArtTodData(port_index);
 }
 } // namespace rdm::discovery
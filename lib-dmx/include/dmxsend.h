@@ -95,6 +95,20 @@ class DmxSend {
         }
     }
 
+    // Zero copy: the merge writes into the transmit buffer, the swap then only flips the buffer index
+    uint8_t* GetTransmitBuffer(uint32_t port_index) {
+        assert(port_index < CHAR_BIT);
+        return Dmx::Get()->GetTransmitBuffer(port_index);
+    }
+
+    void SwapTransmitBuffer(uint32_t port_index, uint32_t length) {
+        assert(port_index < CHAR_BIT);
+        assert(length != 0);
+
+        Dmx::Get()->SwapTransmitBuffer<dmx::SendStyle::kDirect>(port_index, length);
+        panelled::On(panelled::kPortATx << port_index);
+    }
+
     void Sync(uint32_t port_index) {
         const auto kLightsetOffset = port_index + dmxnode::kDmxportOffset;
         assert(dmxnode::Data::GetLength(kLightsetOffset) != 0);
@@ -29,6 +29,18 @@
 #include <cstdint>
 
 namespace dmx {
+struct RdmTiming {
+    static constexpr uint32_t kBuckets = 8;
+    static constexpr uint32_t kResponseBucketBits = 8;    ///< Bucket 0 counts below 256 µs
+    static constexpr uint32_t kBreakToDataBucketBits = 7; ///< Bucket 0 counts below 128 µs
+
+    uint32_t response[kBuckets];      ///< End of request to first byte of the response, bucket n counts below 256 << n µs, the last bucket is open ended
+    uint32_t break_to_data[kBuckets]; ///< Start of the response break to its START Code
+    uint32_t response_min;
+    uint32_t response_max;
+    uint32_t timeout;
+};
+
 struct TotalStatistics {
     struct Dmx {
         uint32_t sent;
@@ -45,6 +57,7 @@ struct TotalStatistics {
             uint32_t classes;
             uint32_t discovery_response;
         } sent;
+        RdmTiming timing;
     } rdm;
 };
 } // namespace dmx
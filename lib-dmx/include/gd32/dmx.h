@@ -41,6 +41,17 @@ struct Data {
     struct Statistics statistics;
 };
 
+namespace dmx {
+inline constexpr uint32_t kDirtyBlockSlots = 64;
+
+/// Slots changed on an input port, slot 1 is the first channel.
+struct Dirty {
+    uint32_t blocks; ///< Bit n set: a slot in 64 * n + 1 .. 64 * (n + 1) has changed, 0 when nothing changed.
+};
+
+static_assert(((kChannelsMax + kDirtyBlockSlots - 1) / kDirtyBlockSlots) <= 32);
+} // namespace dmx
+
 class Dmx {
    public:
     Dmx();
@@ -56,15 +67,18 @@ class Dmx {
 
     volatile dmx::TotalStatistics& GetTotalStatistics(uint32_t port_index);
 
-    // DMX Transmit
+    // DMX Transmit, the setters without a port index apply to all ports
     void SetTransmitBreakTime(uint32_t break_time);
-    [[nodiscard]] uint32_t TransmitBreakTime() const;
+    void SetTransmitBreakTime(uint32_t port_index, uint32_t break_time);
+    [[nodiscard]] uint32_t TransmitBreakTime(uint32_t port_index = 0) const;
 
     void SetTransmitMabTime(uint32_t mab_time);
-    [[nodiscard]] uint32_t TransmitMabTime() const;
+    void SetTransmitMabTime(uint32_t port_index, uint32_t mab_time);
+    [[nodiscard]] uint32_t TransmitMabTime(uint32_t port_index = 0) const;
 
     void SetTransmitPeriodTime(uint32_t period_time);
-    [[nodiscard]] uint32_t TransmitPeriodTime() const { return transmit_period_; }
+    void SetTransmitPeriodTime(uint32_t port_index, uint32_t period_time);
+    [[nodiscard]] uint32_t TransmitPeriodTime(uint32_t port_index = 0) const;
 
     void SetTransmitSlots(uint16_t slots = dmx::kChannelsMax);
     [[nodiscard]] uint16_t TransmitSlots() const { return transmit_slots_; }
@@ -75,6 +89,16 @@ class Dmx {
     template <dmx::SendStyle dmxSendStyle> 
     void SetTransmitDataWithoutSC(uint32_t port_index, const uint8_t* data, uint32_t length);
 
+    /**
+     * Zero copy transmit: fill the slots returned by GetTransmitBuffer,
+     * then SwapTransmitBuffer passes them to the output. The START Code is already set.
+     * Returns nullptr for a receive only port.
+     */
+    uint8_t* GetTransmitBuffer(uint32_t port_index);
+
+    template <dmx::SendStyle dmxSendStyle>
+    void SwapTransmitBuffer(uint32_t port_index, uint32_t length);
+
     void Sync();
 
     void SetOutputStyle(uint32_t port_index, dmx::OutputStyle output_style);
@@ -110,13 +134,16 @@ class Dmx {
     template <uint32_t portIndex> 
     void RdmSendDataInternal(const uint8_t* data, uint32_t length);
 
+    template <dmx::SendStyle dmxSendStyle>
+    void TransmitBufferSwap(uint32_t port_index, uint32_t back_index, uint32_t slots);
+
+    void TransmitTimingUpdate(uint32_t port_index);
+
     void StartSendStyleDirect(uint32_t port_index);
     void StartDmxOutput(uint32_t port_index);
 
     void StartRdmOutput(uint32_t port_index);
 
-    uint32_t transmit_period_{dmx::transmit::kPeriodDefault};
-    uint32_t transmit_period_requested_{dmx::transmit::kPeriodDefault};
     uint32_t transmit_length_[dmx::config::max::kPorts];
     uint16_t transmit_slots_{dmx::kChannelsMax};
     dmx::Direction port_direction_[dmx::config::max::kPorts];
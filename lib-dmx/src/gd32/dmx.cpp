@@ -63,6 +63,7 @@ namespace dmx {
 namespace {
 constexpr uint32_t kDmxSlotsCompleteFlag = 0x8000;
 constexpr uint32_t kRdmSlotsCompleteFlag = 0x4000;
+constexpr uint32_t kRdmDiscoveryResponseMax = 24; ///< 7 bytes preamble, separator, 16 bytes EUID and checksum
 
 enum class TxRxState { kIdle, kDmxBreak, kDmxMab, kDmxData, kDmxInter, kRdmData, kRdmChecksumh, kRdmChecksuml, kRdmdisc };
 enum class RdmTxState { kIdle, kBreak, kMab, kData, kDirection };
@@ -77,7 +78,9 @@ struct DmxTxPacket {
     DmxTxDataPacket data[2];
     uint32_t write_index;
     uint32_t read_index;
+    uint32_t back_index; ///< The buffer handed out by GetTransmitBuffer
     bool data_pending;
+    volatile bool is_filling; ///< The back buffer is being written, the DMA interrupt keeps the read buffer
 };
 
 struct DmxTxData {
@@ -104,6 +107,8 @@ struct DmxTransmit {
     uint32_t break_time;
     uint32_t mab_time;
     uint32_t inter_time;
+    uint32_t period;
+    uint32_t period_requested;
 };
 
 struct RxDmxPackets {
@@ -120,7 +125,8 @@ struct RxDmxData {
 struct RxData {
     struct Dmx {
         volatile RxDmxData current;
-        RxDmxData previous;
+        volatile dmx::Dirty dirty;
+        uint32_t slots_previous;
     } dmx ALIGNED;
     struct Rdm {
         volatile uint8_t data[sizeof(struct TRdmMessage)] ALIGNED;
@@ -193,7 +199,7 @@ volatile dmx::RxDmxPackets sv_rx_dmx_packets[dmx::config::max::kPorts] ALIGNED;
 volatile dmx::RxData sv_rx_buffer[dmx::config::max::kPorts] ALIGNED;
 // DMX TX
 dmx::DmxTxData s_DmxTxBuffer[dmx::config::max::kPorts] ALIGNED SECTION_DMA_BUFFER;
-dmx::DmxTransmit s_dmx_transmit;
+dmx::DmxTransmit s_dmx_transmit[dmx::config::max::kPorts];
 // RDM TX
 dmx::RdmTxData s_RdmTxBuffer[dmx::config::max::kPorts] ALIGNED SECTION_DMA_BUFFER;
 } // namespace
@@ -201,8 +207,240 @@ dmx::RdmTxData s_RdmTxBuffer[dmx::config::max::kPorts] ALIGNED SECTION_DMA_BUFFE
 // RDM RX
 volatile uint32_t gsv_rdm_data_receive_end[dmx::config::max::kPorts];
 
+#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
+namespace dmx {
+namespace {
+struct RdmRxTiming {
+    uint32_t transmit_end;
+    uint32_t break_start;
+    uint32_t data_start;
+    bool has_break;
+    bool is_request_pending;
+};
+
+constexpr uint32_t kTicksPerUs = MCU_CLOCK_FREQ / 1000000U;
+} // namespace
+} // namespace dmx
+
+namespace {
+volatile dmx::RdmRxTiming sv_rdm_rx_timing[dmx::config::max::kPorts];
+} // namespace
+#endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+
+// The RDM timing hooks compile to nothing when the statistics are disabled
+inline void RdmTimingTransmitEnd([[maybe_unused]] uint32_t port_index) {
+#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
+    sv_rdm_rx_timing[port_index].transmit_end = DWT->CYCCNT;
+#endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+}
+
+inline void RdmTimingBreak([[maybe_unused]] uint32_t port_index) {
+#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
+    sv_rdm_rx_timing[port_index].break_start = DWT->CYCCNT;
+#endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+}
+
+inline void RdmTimingDataStart([[maybe_unused]] uint32_t port_index, [[maybe_unused]] bool has_break, [[maybe_unused]] uint32_t slots_received = 0) {
+#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
+    auto& rx_timing = sv_rdm_rx_timing[port_index];
+    rx_timing.data_start = DWT->CYCCNT - (slots_received * dmx::kSlotTime * dmx::kTicksPerUs);
+    rx_timing.has_break = has_break;
+#endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+}
+
+#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
+inline void RdmTimingHistogramAdd(volatile uint32_t* buckets, uint32_t micros, uint32_t bucket_bits) {
+    uint32_t bucket = 0;
+
+    if (micros >= (1U << bucket_bits)) {
+        bucket = std::min((31U - static_cast<uint32_t>(__builtin_clz(micros))) - bucket_bits + 1U, dmx::RdmTiming::kBuckets - 1U);
+    }
+
+    buckets[bucket] = buckets[bucket] + 1;
+}
+#endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+
+#if !defined(CONFIG_DMX_TRANSMIT_ONLY)
+// Receive interrupt only, GetDmxChanged takes its snapshot with interrupts disabled.
+inline void RxDirtyMark(volatile dmx::Dirty& dirty, uint32_t slot) {
+    dirty.blocks = dirty.blocks | (1U << ((slot - 1) / dmx::kDirtyBlockSlots));
+}
+#endif // !defined(CONFIG_DMX_TRANSMIT_ONLY)
+
+#if defined(CONFIG_DMX_RX_DMA) && !defined(CONFIG_DMX_TRANSMIT_ONLY)
+#if defined(GD32F4XX) || defined(GD32H7XX)
+#error CONFIG_DMX_RX_DMA is not supported for this MCU family
+#endif
+/*
+ * DMA receive: the USART interrupts on the break (framing error) and on the idle line only.
+ * A break restarts the DMA at the begin of the port's receive buffer, the idle line after the last slot ends the frame.
+ * Bytes without a preceding break, ending with an idle line, are a discovery response.
+ * Complete DMX frames are copied to the current buffer, RDM messages to the RDM buffer.
+ */
+namespace {
+struct RxDma {
+    uint32_t dma;
+    dma_channel_enum channel;
+    bool available;
+};
+
+// UARTs without a receive DMA channel keep the interrupt per byte
+constexpr RxDma GetRxDmaByUart(uint32_t uart) {
+#if defined(USART0_RX_DMA_CHx)
+    if (uart == USART0) return {USART0_DMAx, USART0_RX_DMA_CHx, true};
+#endif // defined(USART0_RX_DMA_CHx)
+#if defined(USART1_RX_DMA_CHx)
+    if (uart == USART1) return {USART1_DMAx, USART1_RX_DMA_CHx, true};
+#endif // defined(USART1_RX_DMA_CHx)
+#if defined(USART2_RX_DMA_CHx)
+    if (uart == USART2) return {USART2_DMAx, USART2_RX_DMA_CHx, true};
+#endif // defined(USART2_RX_DMA_CHx)
+#if defined(UART3_RX_DMA_CHx)
+    if (uart == UART3) return {UART3_DMAx, UART3_RX_DMA_CHx, true};
+#endif // defined(UART3_RX_DMA_CHx)
+#if defined(UART4_RX_DMA_CHx)
+    if (uart == UART4) return {UART4_DMAx, UART4_RX_DMA_CHx, true};
+#endif // defined(UART4_RX_DMA_CHx)
+#if defined(USART5_RX_DMA_CHx)
+    if (uart == USART5) return {USART5_DMAx, USART5_RX_DMA_CHx, true};
+#endif // defined(USART5_RX_DMA_CHx)
+    return {0, DMA_CH0, false};
+}
+
+constexpr RxDma GetRxDmaByPort(uint32_t port_index) {
+    return GetRxDmaByUart(std::to_underlying(kDirGpio[port_index].uart));
+}
+
+uint8_t s_rx_dma_buffer[dmx::config::max::kPorts][dmx::buffer::kSize] ALIGNED;
+
+inline void DmaStartRx(uint32_t dma_periph, dma_channel_enum channel, uint8_t* buffer) {
+    auto dma_chctl = DMA_CHCTL(dma_periph, channel);
+    dma_chctl &= ~DMA_CHXCTL_CHEN;
+    DMA_CHCTL(dma_periph, channel) = dma_chctl;
+    DMA_CHMADDR(dma_periph, channel) = reinterpret_cast<uint32_t>(buffer);
+    DMA_CHCNT(dma_periph, channel) = dmx::buffer::kSize & DMA_CHXCNT_CNT;
+    DMA_CHCTL(dma_periph, channel) = dma_chctl | DMA_CHXCTL_CHEN;
+}
+
+template <uint32_t kPortIndex>
+void RxDmaFrameComplete(uint32_t length) {
+    auto& rx_buffer = sv_rx_buffer[kPortIndex];
+    const auto* data = s_rx_dma_buffer[kPortIndex];
+
+    if (data[0] == dmx::kStartCode) {
+        const auto kSlots = std::min(length, dmx::kSlotsMax);
+        const auto* src32 = reinterpret_cast<const uint32_t*>(data);
+        auto* dst32 = reinterpret_cast<volatile uint32_t*>(rx_buffer.dmx.current.data);
+        const auto kWords = (kSlots + 3) / 4;
+
+        // Compare while copying, only the bytes that differ are written and marked dirty
+        for (uint32_t i = 0; i < kWords; ++i) {
+            const auto kOld = dst32[i];
+            auto diff = src32[i] ^ kOld;
+
+            if ((i == (kWords - 1)) && ((kSlots & 3) != 0)) {
+                diff &= (1U << ((kSlots & 3) * 8)) - 1; // Stale bytes from an earlier frame
+            }
+
+            if (diff != 0) {
+                dst32[i] = kOld ^ diff;
+                RxDirtyMark(rx_buffer.dmx.dirty, (i * 4) + (static_cast<uint32_t>(__builtin_ctz(diff)) / 8));
+                RxDirtyMark(rx_buffer.dmx.dirty, (i * 4) + ((31U - static_cast<uint32_t>(__builtin_clz(diff))) / 8));
+            }
+        }
+
+        rx_buffer.dmx.current.slots_in_packet = kSlots | dmx::kDmxSlotsCompleteFlag;
+        sv_rx_dmx_packets[kPortIndex].count = sv_rx_dmx_packets[kPortIndex].count + 1;
+        return;
+    }
+
+    if (data[0] == E120_SC_RDM) {
+        const auto* message = reinterpret_cast<const struct TRdmMessage*>(data);
+        const uint32_t kMessageLength = message->message_length;
+
+        // Message plus 2 checksum bytes, anything shorter is incomplete
+        if ((length < (e120::kMessageLengthMin + 2U)) || (kMessageLength < e120::kMessageLengthMin) || ((kMessageLength + 2U) > std::min(length, static_cast<uint32_t>(sizeof(struct TRdmMessage))))) {
+            return;
+        }
+
+        for (uint32_t i = 0; i < (kMessageLength + 2U); ++i) {
+            rx_buffer.rdm.data[i] = data[i];
+        }
+
+        rx_buffer.rdm.index = (kMessageLength + 1U) | dmx::kRdmSlotsCompleteFlag;
+        gsv_rdm_data_receive_end[kPortIndex] = DWT->CYCCNT;
+        // No interrupt per slot, the start is derived from the frame length
+        RdmTimingDataStart(kPortIndex, true, length);
+    }
+}
+
+template <uint32_t kUsartPeripheral>
+void IrqHandlerDmxRdmInputDma() {
+    constexpr auto kPortIndex = GetPortByUart(kUsartPeripheral);
+    constexpr auto kRxDma = GetRxDmaByUart(kUsartPeripheral);
+    auto& rx_buffer = sv_rx_buffer[kPortIndex];
+
+    const auto kIsFlagFrameError = gd32::UartFlagGet<USART_FLAG_FERR>(kUsartPeripheral);
+    const auto kIsFlagIdleFrame = gd32::UartFlagGet<USART_FLAG_IDLE>(kUsartPeripheral);
+
+    // Software can clear IDLE, FERR, NERR and ORERR by reading the USART_STAT and USART_DATA registers one by one.
+    static_cast<void>(GET_BITS(USART_RDATA(kUsartPeripheral), 0U, 8U));
+
+    const auto kReceived = dmx::buffer::kSize - DMA_CHCNT(kRxDma.dma, kRxDma.channel);
+
+    if (kIsFlagFrameError) {
+        // A break is received as 0x00 with a framing error, the DMA has stored it as the last byte.
+        if ((kReceived == 0) || (s_rx_dma_buffer[kPortIndex][kReceived - 1] != 0)) {
+            return;
+        }
+
+        if (rx_buffer.state == dmx::TxRxState::kDmxBreak) {
+            // No idle line between the last slot and this break
+            if (kReceived > 1) {
+                RxDmaFrameComplete<kPortIndex>(kReceived - 1);
+            }
+        } else if (kReceived > 1) {
+            // Framing error within a discovery response (collision), keep receiving
+            return;
+        }
+
+        rx_buffer.state = dmx::TxRxState::kDmxBreak;
+        RdmTimingBreak(kPortIndex);
+        DmaStartRx(kRxDma.dma, kRxDma.channel, s_rx_dma_buffer[kPortIndex]);
+        return;
+    }
+
+    if (!kIsFlagIdleFrame || (kReceived == 0)) {
+        return;
+    }
+
+    if (rx_buffer.state == dmx::TxRxState::kDmxBreak) {
+        RxDmaFrameComplete<kPortIndex>(kReceived);
+    } else {
+        const auto kLength = std::min(kReceived, dmx::kRdmDiscoveryResponseMax);
+
+        for (uint32_t i = 0; i < kLength; ++i) {
+            rx_buffer.rdm.data[i] = s_rx_dma_buffer[kPortIndex][i];
+        }
+
+        rx_buffer.rdm.index = kLength | dmx::kRdmSlotsCompleteFlag;
+        RdmTimingDataStart(kPortIndex, false, kReceived);
+    }
+
+    rx_buffer.state = dmx::TxRxState::kIdle;
+    DmaStartRx(kRxDma.dma, kRxDma.channel, s_rx_dma_buffer[kPortIndex]);
+}
+} // namespace
+#endif // defined(CONFIG_DMX_RX_DMA) && !defined(CONFIG_DMX_TRANSMIT_ONLY)
+
 template <uint32_t kUsartPeripheral>
 void IrqHandlerDmxRdmInput() {
+#if defined(CONFIG_DMX_RX_DMA) && !defined(CONFIG_DMX_TRANSMIT_ONLY)
+    if constexpr (GetRxDmaByUart(kUsartPeripheral).available) {
+        IrqHandlerDmxRdmInputDma<kUsartPeripheral>();
+        return;
+    }
+#endif // defined(CONFIG_DMX_RX_DMA) && !defined(CONFIG_DMX_TRANSMIT_ONLY)
     constexpr auto kPortIndex = GetPortByUart(kUsartPeripheral);
     auto& rx_buffer = sv_rx_buffer[kPortIndex];
     const auto kIsFlagIdleFrame = (USART_REG_VAL(kUsartPeripheral, USART_FLAG_IDLE) & BIT(USART_BIT_POS(USART_FLAG_IDLE))) == BIT(USART_BIT_POS(USART_FLAG_IDLE));
@@ -235,6 +473,7 @@ void IrqHandlerDmxRdmInput() {
 
         if (rx_buffer.state == dmx::TxRxState::kIdle) {
             rx_buffer.state = dmx::TxRxState::kDmxBreak;
+            RdmTimingBreak(kPortIndex);
         }
 
         return;
@@ -247,6 +486,7 @@ void IrqHandlerDmxRdmInput() {
             rx_buffer.state = dmx::TxRxState::kRdmdisc;
             rx_buffer.rdm.data[0] = kData;
             rx_buffer.rdm.index = 1;
+            RdmTimingDataStart(kPortIndex, false);
             break;
 
         case dmx::TxRxState::kDmxBreak:
@@ -262,6 +502,7 @@ void IrqHandlerDmxRdmInput() {
                     rx_buffer.rdm.data[0] = E120_SC_RDM;
                     rx_buffer.rdm.index = 1;
                     rx_buffer.state = dmx::TxRxState::kRdmData;
+                    RdmTimingDataStart(kPortIndex, true);
                 } break;
 
                 default:
@@ -276,7 +517,12 @@ void IrqHandlerDmxRdmInput() {
 
         case dmx::TxRxState::kDmxData: {
             auto index = rx_buffer.dmx.current.slots_in_packet;
-            rx_buffer.dmx.current.data[index] = kData;
+
+            if (rx_buffer.dmx.current.data[index] != kData) {
+                rx_buffer.dmx.current.data[index] = kData;
+                RxDirtyMark(rx_buffer.dmx.dirty, index);
+            }
+
             index++;
             rx_buffer.dmx.current.slots_in_packet = index;
 
@@ -323,7 +569,7 @@ void IrqHandlerDmxRdmInput() {
         case dmx::TxRxState::kRdmdisc: {
             auto index = rx_buffer.rdm.index;
 
-            if (index < 24) { // TODO (a) Replace 24 with constepr
+            if (index < dmx::kRdmDiscoveryResponseMax) {
                 rx_buffer.rdm.data[index] = kData;
                 index++;
                 rx_buffer.rdm.index = index;
@@ -362,7 +608,7 @@ template <uint32_t kUsartPeripheral, uint32_t kDmaController, dma_channel_enum k
 void DmaRestartDmxTx(TxBufferType& tx_buffer) {
     auto& dmx = tx_buffer.dmx;
 
-    if (dmx.read_index != dmx.write_index) {
+    if ((dmx.read_index != dmx.write_index) && !dmx.is_filling) {
         dmx.read_index ^= 1;
     }
 
@@ -446,7 +692,7 @@ void TIMER1_IRQHandler() {
                         Gd32GpioModeOutput<USART0_GPIOx, USART0_TX_GPIO_PINx>();
                         GPIO_BC(USART0_GPIOx) = USART0_TX_GPIO_PINx;
                         s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
-                        TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
+                        TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].break_time;
                     }
                     break;
 
@@ -454,7 +700,7 @@ void TIMER1_IRQHandler() {
                     [[likely]] {
                         Gd32GpioModeAf<USART0_GPIOx, USART0_TX_GPIO_PINx, USART0>();
                         s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxMab;
-                        TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.mab_time;
+                        TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].mab_time;
                     }
                     break;
 
@@ -492,6 +738,7 @@ void TIMER1_IRQHandler() {
                     const auto kSent = sv_total_statistics[kPortIndex].rdm.sent.classes + 1;
                     sv_total_statistics[kPortIndex].rdm.sent.classes = kSent;
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+                    RdmTimingTransmitEnd(kPortIndex);
                 } break;
 
                 default:
@@ -514,7 +761,7 @@ void TIMER1_IRQHandler() {
                         Gd32GpioModeOutput<USART1_GPIOx, USART1_TX_GPIO_PINx>();
                         GPIO_BC(USART1_GPIOx) = USART1_TX_GPIO_PINx;
                         s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
-                        TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
+                        TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].break_time;
                     }
                     break;
 
@@ -522,7 +769,7 @@ void TIMER1_IRQHandler() {
                     [[likely]] {
                         Gd32GpioModeAf<USART1_GPIOx, USART1_TX_GPIO_PINx, USART1>();
                         s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxMab;
-                        TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.mab_time;
+                        TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].mab_time;
                     }
                     break;
 
@@ -560,6 +807,7 @@ void TIMER1_IRQHandler() {
                     const auto kSent = sv_total_statistics[kPortIndex].rdm.sent.classes + 1;
                     sv_total_statistics[kPortIndex].rdm.sent.classes = kSent;
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+                    RdmTimingTransmitEnd(kPortIndex);
                 } break;
 
                 default:
@@ -583,7 +831,7 @@ void TIMER1_IRQHandler() {
                         Gd32GpioModeOutput<USART2_GPIOx, USART2_TX_GPIO_PINx>();
                         GPIO_BC(USART2_GPIOx) = USART2_TX_GPIO_PINx;
                         s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
-                        TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
+                        TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].break_time;
                     }
                     break;
 
@@ -591,7 +839,7 @@ void TIMER1_IRQHandler() {
                     [[likely]] {
                         Gd32GpioModeAf<USART2_GPIOx, USART2_TX_GPIO_PINx, USART2>();
                         s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxMab;
-                        TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.mab_time;
+                        TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].mab_time;
                     }
                     break;
 
@@ -630,6 +878,7 @@ void TIMER1_IRQHandler() {
                     const auto kSent = sv_total_statistics[kPortIndex].rdm.sent.classes + 1;
                     sv_total_statistics[kPortIndex].rdm.sent.classes = kSent;
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+                    RdmTimingTransmitEnd(kPortIndex);
                 } break;
 
                 default:
@@ -652,14 +901,14 @@ void TIMER1_IRQHandler() {
                         Gd32GpioModeOutput<UART3_GPIOx, UART3_TX_GPIO_PINx>();
                         GPIO_BC(UART3_GPIOx) = UART3_TX_GPIO_PINx;
                         s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
-                        TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
+                        TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].break_time;
                     }
                     break;
                 case dmx::TxRxState::kDmxBreak:
                     [[likely]] {
                         Gd32GpioModeAf<UART3_GPIOx, UART3_TX_GPIO_PINx, UART3>();
                         s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxMab;
-                        TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.mab_time;
+                        TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].mab_time;
                     }
                     break;
                 case dmx::TxRxState::kDmxMab:
@@ -696,6 +945,7 @@ void TIMER1_IRQHandler() {
                         const auto kSent = sv_total_statistics[kPortIndex].rdm.sent.classes + 1;
                         sv_total_statistics[kPortIndex].rdm.sent.classes = kSent;
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+                        RdmTimingTransmitEnd(kPortIndex);
                     }
                     break;
 
@@ -724,7 +974,7 @@ void TIMER4_IRQHandler() {
                         Gd32GpioModeOutput<UART4_TX_GPIOx, UART4_TX_GPIO_PINx>();
                         GPIO_BC(UART4_TX_GPIOx) = UART4_TX_GPIO_PINx;
                         s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
-                        TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
+                        TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].break_time;
                     }
                     break;
 
@@ -732,7 +982,7 @@ void TIMER4_IRQHandler() {
                     [[likely]] {
                         Gd32GpioModeAf<UART4_TX_GPIOx, UART4_TX_GPIO_PINx, UART4>();
                         s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxMab;
-                        TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.mab_time;
+                        TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].mab_time;
                     }
                     break;
 
@@ -772,6 +1022,7 @@ void TIMER4_IRQHandler() {
                         const auto kSent = sv_total_statistics[kPortIndex].rdm.sent.classes + 1;
                         sv_total_statistics[kPortIndex].rdm.sent.classes = kSent;
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+                        RdmTimingTransmitEnd(kPortIndex);
                     }
                     break;
 
@@ -795,7 +1046,7 @@ void TIMER4_IRQHandler() {
                         Gd32GpioModeOutput<USART5_GPIOx, USART5_TX_GPIO_PINx>();
                         GPIO_BC(USART5_GPIOx) = USART5_TX_GPIO_PINx;
                         s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
-                        TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
+                        TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].break_time;
                     }
                     break;
 
@@ -803,7 +1054,7 @@ void TIMER4_IRQHandler() {
                     [[likely]] {
                         Gd32GpioModeAf<USART5_GPIOx, USART5_TX_GPIO_PINx, USART5>();
                         s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxMab;
-                        TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.mab_time;
+                        TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].mab_time;
                     }
                     break;
 
@@ -842,6 +1093,7 @@ void TIMER4_IRQHandler() {
                         const auto kSent = sv_total_statistics[kPortIndex].rdm.sent.classes + 1;
                         sv_total_statistics[kPortIndex].rdm.sent.classes = kSent;
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+                        RdmTimingTransmitEnd(kPortIndex);
                     }
                     break;
 
@@ -864,12 +1116,12 @@ void TIMER4_IRQHandler() {
                     Gd32GpioModeOutput<UART6_GPIOx, UART6_TX_GPIO_PINx>();
                     GPIO_BC(UART6_GPIOx) = UART6_TX_GPIO_PINx;
                     s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
-                    TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
+                    TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].break_time;
                     break;
                 case dmx::TxRxState::kDmxBreak:
                     Gd32GpioModeAf<UART6_GPIOx, UART6_TX_GPIO_PINx, UART6>();
                     s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxMab;
-                    TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.mab_time;
+                    TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].mab_time;
                     break;
                 case dmx::TxRxState::kDmxMab: {
                     DMA_RESTART_DMX_TX(kPortIndex, UART6, UART6_DMAx, UART6_TX_DMA_CHx);
@@ -902,6 +1154,7 @@ void TIMER4_IRQHandler() {
                         const auto kSent = sv_total_statistics[kPortIndex].rdm.sent.classes + 1;
                         sv_total_statistics[kPortIndex].rdm.sent.classes = kSent;
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+                        RdmTimingTransmitEnd(kPortIndex);
                     }
                     break;
 
@@ -924,12 +1177,12 @@ void TIMER4_IRQHandler() {
                     Gd32GpioModeOutput<UART7_GPIOx, UART7_TX_GPIO_PINx>();
                     GPIO_BC(UART7_GPIOx) = UART7_TX_GPIO_PINx;
                     s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
-                    TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
+                    TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].break_time;
                     break;
                 case dmx::TxRxState::kDmxBreak:
                     Gd32GpioModeAf<UART7_GPIOx, UART7_TX_GPIO_PINx, UART7>();
                     s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxMab;
-                    TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.mab_time;
+                    TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].mab_time;
                     break;
                 case dmx::TxRxState::kDmxMab: {
                     DMA_RESTART_DMX_TX(kPortIndex, UART7, UART7_DMAx, UART7_TX_DMA_CHx);
@@ -962,6 +1215,7 @@ void TIMER4_IRQHandler() {
                         const auto kSent = sv_total_statistics[kPortIndex].rdm.sent.classes + 1;
                         sv_total_statistics[kPortIndex].rdm.sent.classes = kSent;
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+                        RdmTimingTransmitEnd(kPortIndex);
                     }
                     break;
 
@@ -1009,7 +1263,7 @@ void DMA1_Channel7_IRQHandler() {
             if (s_DmxTxBuffer[kPortIndex].output_style == dmx::OutputStyle::kDelta) {
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kIdle;
             } else {
-                TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.inter_time;
+                TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].inter_time;
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxInter;
             }
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
@@ -1035,7 +1289,7 @@ void DMA0_Channel3_IRQHandler() {
             if (s_DmxTxBuffer[kPortIndex].output_style == dmx::OutputStyle::kDelta) {
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kIdle;
             } else {
-                TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.inter_time;
+                TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].inter_time;
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxInter;
             }
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
@@ -1064,7 +1318,7 @@ void DMA0_Channel6_IRQHandler() {
             if (s_DmxTxBuffer[kPortIndex].output_style == dmx::OutputStyle::kDelta) {
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kIdle;
             } else {
-                TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.inter_time;
+                TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].inter_time;
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxInter;
             }
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
@@ -1093,7 +1347,7 @@ void DMA0_Channel3_IRQHandler() {
             if (s_DmxTxBuffer[kPortIndex].output_style == dmx::OutputStyle::kDelta) {
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kIdle;
             } else {
-                TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.inter_time;
+                TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].inter_time;
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxInter;
             }
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
@@ -1119,7 +1373,7 @@ void DMA0_Channel1_IRQHandler() {
             if (s_DmxTxBuffer[kPortIndex].output_style == dmx::OutputStyle::kDelta) {
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kIdle;
             } else {
-                TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.inter_time;
+                TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].inter_time;
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxInter;
             }
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
@@ -1149,7 +1403,7 @@ void DMA0_Channel4_IRQHandler() {
             if (s_DmxTxBuffer[kPortIndex].output_style == dmx::OutputStyle::kDelta) {
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kIdle;
             } else {
-                TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.inter_time;
+                TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].inter_time;
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxInter;
             }
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
@@ -1175,7 +1429,7 @@ void DMA1_Channel4_IRQHandler() {
             if (s_DmxTxBuffer[kPortIndex].output_style == dmx::OutputStyle::kDelta) {
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kIdle;
             } else {
-                TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.inter_time;
+                TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].inter_time;
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxInter;
             }
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
@@ -1205,7 +1459,7 @@ void DMA1_Channel3_IRQHandler() {
             if (s_DmxTxBuffer[kPortIndex].output_style == dmx::OutputStyle::kDelta) {
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kIdle;
             } else {
-                TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.inter_time;
+                TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].inter_time;
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxInter;
             }
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
@@ -1232,7 +1486,7 @@ void DMA0_Channel7_IRQHandler() {
             if (s_DmxTxBuffer[kPortIndex].output_style == dmx::OutputStyle::kDelta) {
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kIdle;
             } else {
-                TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.inter_time;
+                TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].inter_time;
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxInter;
             }
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
@@ -1264,7 +1518,7 @@ void DMA1_Channel6_IRQHandler() {
             if (s_DmxTxBuffer[kPortIndex].output_style == dmx::OutputStyle::kDelta) {
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kIdle;
             } else {
-                TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.inter_time;
+                TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].inter_time;
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxInter;
             }
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
@@ -1291,7 +1545,7 @@ void DMA1_Channel4_IRQHandler() {
             if (s_DmxTxBuffer[dmx::config::kUart6Port].output_style == dmx::OutputStyle::kDelta) {
                 s_DmxTxBuffer[dmx::config::kUart6Port].state = dmx::TxRxState::kIdle;
             } else {
-                TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.inter_time;
+                TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[dmx::config::kUart6Port].inter_time;
                 s_DmxTxBuffer[dmx::config::kUart6Port].state = dmx::TxRxState::kDmxInter;
             }
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
@@ -1319,7 +1573,7 @@ void DMA0_Channel1_IRQHandler() {
             if (s_DmxTxBuffer[kPortIndex].output_style == dmx::OutputStyle::kDelta) {
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kIdle;
             } else {
-                TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.inter_time;
+                TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].inter_time;
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxInter;
             }
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
@@ -1347,7 +1601,7 @@ void DMA1_Channel3_IRQHandler() {
             if (s_DmxTxBuffer[dmx::config::kUart7Port].output_style == dmx::OutputStyle::kDelta) {
                 s_DmxTxBuffer[dmx::config::kUart7Port].state = dmx::TxRxState::kIdle;
             } else {
-                TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.inter_time;
+                TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[dmx::config::kUart7Port].inter_time;
                 s_DmxTxBuffer[dmx::config::kUart7Port].state = dmx::TxRxState::kDmxInter;
             }
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
@@ -1373,7 +1627,7 @@ void DMA0_Channel0_IRQHandler() {
             if (s_DmxTxBuffer[kPortIndex].output_style == dmx::OutputStyle::kDelta) {
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kIdle;
             } else {
-                TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.inter_time;
+                TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].inter_time;
                 s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxInter;
             }
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
@@ -1472,6 +1726,22 @@ void Dmx::DataEnable(uint32_t port_index) {
             __DMB();
         } while (!gd32::UartFlagGet<USART_FLAG_TBE>(kUart));
 
+#if defined(CONFIG_DMX_RX_DMA) && !defined(CONFIG_DMX_TRANSMIT_ONLY)
+        if (const auto kRxDma = GetRxDmaByPort(port_index); kRxDma.available) {
+            // Clear stale IDLE, FERR and ORERR
+            static_cast<void>(USART_REG_VAL(kUart, USART_FLAG_IDLE));
+            static_cast<void>(GET_BITS(USART_RDATA(kUart), 0U, 8U));
+
+            DmaStartRx(kRxDma.dma, kRxDma.channel, s_rx_dma_buffer[port_index]);
+            USART_CTL2(kUart) |= USART_CTL2_DENR;
+            gd32::UartInterruptEnable<USART_INT_ERR>(kUart);
+            gd32::UartInterruptEnable<USART_INT_IDLE>(kUart);
+
+            sv_port_state[port_index] = dmx::PortState::kRx;
+            return;
+        }
+#endif // defined(CONFIG_DMX_RX_DMA) && !defined(CONFIG_DMX_TRANSMIT_ONLY)
+
         gd32::UartInterruptFlagClear<USART_INT_FLAG_RBNE>(kUart);
         gd32::UartInterruptFlagClear<USART_INT_FLAG_IDLE>(kUart);
         gd32::UartInterruptEnable<USART_INT_RBNE>(kUart);
@@ -1511,6 +1781,16 @@ void Dmx::DataDisable(uint32_t port_index) {
     }
 
     if (port_direction_[port_index] == dmx::Direction::kInput) {
+#if defined(CONFIG_DMX_RX_DMA) && !defined(CONFIG_DMX_TRANSMIT_ONLY)
+        if (const auto kRxDma = GetRxDmaByPort(port_index); kRxDma.available) {
+            gd32::UartInterruptDisable<USART_INT_ERR>(kUart);
+            gd32::UartInterruptDisable<USART_INT_IDLE>(kUart);
+            USART_CTL2(kUart) &= ~USART_CTL2_DENR;
+            DMA_CHCTL(kRxDma.dma, kRxDma.channel) &= ~DMA_CHXCTL_CHEN;
+            sv_rx_buffer[port_index].state = dmx::TxRxState::kIdle;
+            return;
+        }
+#endif // defined(CONFIG_DMX_RX_DMA) && !defined(CONFIG_DMX_TRANSMIT_ONLY)
         gd32::UartInterruptDisable<USART_INT_RBNE>(kUart);
         gd32::UartInterruptDisable<USART_INT_FLAG_IDLE>(kUart);
         sv_rx_buffer[port_index].state = dmx::TxRxState::kIdle;
@@ -1574,6 +1854,17 @@ void Dmx::FullOn() {
 }
 
 // DMX Send
+namespace {
+/**
+ * The buffer the DMA is not reading from. With a frame still pending
+ * that frame is replaced, otherwise it is the other half of the pair.
+ */
+inline uint32_t TransmitBackIndex(const dmx::DmxTxPacket& dmx) {
+    const auto kHasDataPending = dmx.read_index != dmx.write_index;
+    return kHasDataPending ? dmx.write_index : (dmx.write_index ^ 1);
+}
+} // namespace
+
 template <uint32_t kPortIndex, bool kHasStartCode, dmx::SendStyle kSendStyle>
 void Dmx::SetSendDataInternal(const uint8_t* data, uint32_t length) {
     static_assert(kPortIndex < dmx::config::max::kPorts);
@@ -1582,22 +1873,15 @@ void Dmx::SetSendDataInternal(const uint8_t* data, uint32_t length) {
         return;
     }
 
-    auto& tx_buffer = s_DmxTxBuffer[kPortIndex];
-    const auto kHasDataPending = tx_buffer.dmx.read_index != tx_buffer.dmx.write_index;
-
-    if (!kHasDataPending) {
-        // No pending data — switch to the other buffer
-        tx_buffer.dmx.write_index ^= 1;
-    }
+    auto& dmx = s_DmxTxBuffer[kPortIndex].dmx;
 
-    const auto kWriteIndex = tx_buffer.dmx.write_index;
+    dmx.is_filling = true;
+    __DMB();
 
-    auto* dst_data = tx_buffer.dmx.data[kWriteIndex].data;
+    const auto kBackIndex = TransmitBackIndex(dmx);
+    auto* dst_data = dmx.data[kBackIndex].data;
 
     const auto kCappedLength = (length < transmit_slots_) ? length : transmit_slots_;
-    tx_buffer.dmx.data[kWriteIndex].length = kCappedLength + 1;
-
-    tx_buffer.dmx.data_pending = true;
 
     if constexpr (kHasStartCode) {
         memcpy(dst_data, data, kCappedLength);
@@ -1606,13 +1890,62 @@ void Dmx::SetSendDataInternal(const uint8_t* data, uint32_t length) {
         memcpy(&dst_data[1], data, kCappedLength);
     }
 
-    if (kCappedLength != transmit_length_[kPortIndex]) {
-        transmit_length_[kPortIndex] = kCappedLength;
-        SetTransmitPeriodTime(transmit_period_requested_);
+    TransmitBufferSwap<kSendStyle>(kPortIndex, kBackIndex, kCappedLength);
+}
+
+uint8_t* Dmx::GetTransmitBuffer(uint32_t port_index) {
+    DMX_CHECK_PORT_INDEX_PTR(port_index);
+
+    if (kDirGpio[port_index].usage == dmx::port::Usage::kRxOnly) {
+        return nullptr;
+    }
+
+    auto& dmx = s_DmxTxBuffer[port_index].dmx;
+
+    dmx.is_filling = true;
+    __DMB();
+
+    dmx.back_index = TransmitBackIndex(dmx);
+
+    auto* data = dmx.data[dmx.back_index].data;
+    data[0] = dmx::kStartCode;
+
+    return &data[1];
+}
+
+template <dmx::SendStyle kSendStyle>
+void Dmx::SwapTransmitBuffer(uint32_t port_index, uint32_t length) {
+    DMX_CHECK_PORT_INDEX_VOID(port_index);
+
+    auto& dmx = s_DmxTxBuffer[port_index].dmx;
+    assert(dmx.is_filling);
+
+    TransmitBufferSwap<kSendStyle>(port_index, dmx.back_index, (length < transmit_slots_) ? length : transmit_slots_);
+}
+
+/**
+ * Hands the back buffer \p back_index, holding \p slots channels, over to the DMA.
+ * The buffer was taken with is_filling set, so the DMA interrupt has not flipped to it.
+ */
+template <dmx::SendStyle kSendStyle>
+void Dmx::TransmitBufferSwap(uint32_t port_index, uint32_t back_index, uint32_t slots) {
+    auto& tx_buffer = s_DmxTxBuffer[port_index];
+
+    tx_buffer.dmx.data[back_index].length = slots + 1;
+    tx_buffer.dmx.write_index = back_index;
+
+    tx_buffer.dmx.data_pending = true;
+
+    __DMB();
+    tx_buffer.dmx.is_filling = false;
+
+    if (slots != transmit_length_[port_index]) {
+        transmit_length_[port_index] = slots;
+        TransmitTimingUpdate(port_index);
     }
 
     if constexpr (kSendStyle == dmx::SendStyle::kDirect) {
-        StartSendStyleDirect(kPortIndex);
+        StartSendStyleDirect(port_index);
     }
 }
 
@@ -1644,7 +1977,7 @@ void StartDmxOutputBreak() {
         case USART0:
             Gd32GpioModeOutput<USART0_GPIOx, USART0_TX_GPIO_PINx>();
             GPIO_BC(USART0_GPIOx) = USART0_TX_GPIO_PINx;
-            TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
+            TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].break_time;
             s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
             return;
             break;
@@ -1653,7 +1986,7 @@ void StartDmxOutputBreak() {
         case USART1:
             Gd32GpioModeOutput<USART1_GPIOx, USART1_TX_GPIO_PINx>();
             GPIO_BC(USART1_GPIOx) = USART1_TX_GPIO_PINx;
-            TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
+            TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].break_time;
             s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
             return;
             break;
@@ -1662,7 +1995,7 @@ void StartDmxOutputBreak() {
         case USART2:
             Gd32GpioModeOutput<USART2_GPIOx, USART2_TX_GPIO_PINx>();
             GPIO_BC(USART2_GPIOx) = USART2_TX_GPIO_PINx;
-            TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
+            TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].break_time;
             s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
             return;
             break;
@@ -1671,7 +2004,7 @@ void StartDmxOutputBreak() {
         case UART3:
             Gd32GpioModeOutput<UART3_GPIOx, UART3_TX_GPIO_PINx>();
             GPIO_BC(UART3_GPIOx) = UART3_TX_GPIO_PINx;
-            TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
+            TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit[kPortIndex].break_time;
             s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
             return;
             break;
@@ -1681,7 +2014,7 @@ void StartDmxOutputBreak() {
         case UART4:
             Gd32GpioModeOutput<UART4_TX_GPIOx, UART4_TX_GPIO_PINx>();
             GPIO_BC(UART4_TX_GPIOx) = UART4_TX_GPIO_PINx;
-            TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
+            TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].break_time;
             s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
             return;
             break;
@@ -1690,7 +2023,7 @@ void StartDmxOutputBreak() {
         case USART5:
             Gd32GpioModeOutput<USART5_GPIOx, USART5_TX_GPIO_PINx>();
             GPIO_BC(USART5_GPIOx) = USART5_TX_GPIO_PINx;
-            TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
+            TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].break_time;
             s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
             return;
             break;
@@ -1699,7 +2032,7 @@ void StartDmxOutputBreak() {
         case UART6:
             Gd32GpioModeOutput<UART6_GPIOx, UART6_TX_GPIO_PINx>();
             GPIO_BC(UART6_GPIOx) = UART6_TX_GPIO_PINx;
-            TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
+            TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].break_time;
             s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
             return;
             break;
@@ -1708,7 +2041,7 @@ void StartDmxOutputBreak() {
         case UART7:
             Gd32GpioModeOutput<UART7_GPIOx, UART7_TX_GPIO_PINx>();
             GPIO_BC(UART7_GPIOx) = UART7_TX_GPIO_PINx;
-            TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
+            TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit[kPortIndex].break_time;
             s_DmxTxBuffer[kPortIndex].state = dmx::TxRxState::kDmxBreak;
             return;
             break;
@@ -1823,6 +2156,11 @@ void Dmx::RdmSendDataInternal(const uint8_t* data, uint32_t length) {
     assert(data != nullptr);
     assert(length <= sizeof(TRdmMessage));
 
+#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
+    // Only requests, with an even command class, are answered
+    sv_rdm_rx_timing[kPortIndex].is_request_pending = (reinterpret_cast<const struct TRdmMessage*>(data)->command_class & 0x01) == 0;
+#endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+
     SetPortDirection<kPortIndex, dmx::Direction::kOutput, false>();
 
     auto& tx_buffer = s_RdmTxBuffer[kPortIndex];
@@ -2021,38 +2359,28 @@ void Dmx::Sync() {
 // DMX Receive
 const uint8_t* Dmx::GetDmxChanged([[maybe_unused]] uint32_t port_index) {
 #if !defined(CONFIG_DMX_TRANSMIT_ONLY)
-    const auto* __restrict__ available = GetDmxAvailable(port_index);
+    const auto* available = GetDmxAvailable(port_index);
 
     if (available == nullptr) {
         return nullptr;
     }
 
-    const auto* __restrict__ src32 = reinterpret_cast<const volatile uint32_t*>(sv_rx_buffer[port_index].dmx.current.data);
-    auto* __restrict__ dst32 = reinterpret_cast<volatile uint32_t*>(sv_rx_buffer[port_index].dmx.previous.data);
+    auto& rx_dmx = sv_rx_buffer[port_index].dmx;
 
-    if (sv_rx_buffer[port_index].dmx.current.slots_in_packet != sv_rx_buffer[port_index].dmx.previous.slots_in_packet) {
-        sv_rx_buffer[port_index].dmx.previous.slots_in_packet = sv_rx_buffer[port_index].dmx.current.slots_in_packet;
+    __disable_irq();
+    const uint32_t kBlocks = rx_dmx.dirty.blocks;
+    rx_dmx.dirty.blocks = 0;
+    __enable_irq();
 
-        for (size_t i = 0; i < dmx::buffer::kSize / 4; ++i) {
-            dst32[i] = src32[i];
-        }
+    const uint32_t kSlots = rx_dmx.current.slots_in_packet;
 
+    // A change in the slot count changes the whole frame
+    if (kSlots != rx_dmx.slots_previous) {
+        rx_dmx.slots_previous = kSlots;
         return available;
     }
 
-    bool is_changed = false;
-
-    for (size_t i = 0; i < dmx::buffer::kSize / 4; ++i) {
-        const auto kSrcValue = src32[i];
-        auto dst_value = dst32[i];
-
-        if (kSrcValue != dst_value) {
-            dst32[i] = kSrcValue;
-            is_changed = true;
-        }
-    }
-
-    return (is_changed ? available : nullptr);
+    return (kBlocks != 0) ? available : nullptr;
 #else
     return nullptr;
 #endif // !defined(CONFIG_DMX_TRANSMIT_ONLY)
@@ -2128,6 +2456,37 @@ void Dmx::RdmTransmitDiscoveryRespondMessage(uint32_t port_index, const uint8_t*
 }
 
 // RDM Receive
+namespace {
+void RdmTimingResponse([[maybe_unused]] uint32_t port_index) {
+#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
+    auto& rx_timing = sv_rdm_rx_timing[port_index];
+
+    if (!rx_timing.is_request_pending) {
+        return;
+    }
+
+    rx_timing.is_request_pending = false;
+
+    auto& timing = sv_total_statistics[port_index].rdm.timing;
+    const auto kResponseUs = (rx_timing.data_start - rx_timing.transmit_end) / dmx::kTicksPerUs;
+
+    RdmTimingHistogramAdd(timing.response, kResponseUs, dmx::RdmTiming::kResponseBucketBits);
+
+    if ((timing.response_min == 0) || (kResponseUs < timing.response_min)) {
+        timing.response_min = kResponseUs;
+    }
+
+    if (kResponseUs > timing.response_max) {
+        timing.response_max = kResponseUs;
+    }
+
+    if (rx_timing.has_break) {
+        RdmTimingHistogramAdd(timing.break_to_data, (rx_timing.data_start - rx_timing.break_start) / dmx::kTicksPerUs, dmx::RdmTiming::kBreakToDataBucketBits);
+    }
+#endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+}
+} // namespace
+
 const uint8_t* Dmx::RdmReceive(uint32_t port_index) {
     DMX_CHECK_PORT_INDEX_PTR(port_index);
 
@@ -2158,6 +2517,7 @@ const uint8_t* Dmx::RdmReceive(uint32_t port_index) {
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
                 sv_total_statistics[port_index].rdm.received.good = sv_total_statistics[port_index].rdm.received.good + 1;
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+                RdmTimingResponse(port_index);
                 return data;
             }
         }
@@ -2170,6 +2530,7 @@ const uint8_t* Dmx::RdmReceive(uint32_t port_index) {
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
     sv_total_statistics[port_index].rdm.received.discovery_response = sv_total_statistics[port_index].rdm.received.discovery_response + 1;
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+    RdmTimingResponse(port_index);
 
     return data;
 }
@@ -2189,6 +2550,13 @@ const uint8_t* Dmx::RdmReceiveTimeOut(uint32_t port_index, uint16_t timeout_ms)
         }
     } while (TIMER_CNT(TIMER5) < timeout_ms);
 
+#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
+    if (sv_rdm_rx_timing[port_index].is_request_pending) {
+        sv_rdm_rx_timing[port_index].is_request_pending = false;
+        sv_total_statistics[port_index].rdm.timing.timeout = sv_total_statistics[port_index].rdm.timing.timeout + 1;
+    }
+#endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+
     return nullptr;
 }
 
@@ -2199,6 +2567,9 @@ template void Dmx::SetTransmitDataWithSC<dmx::SendStyle::kSync>(const uint32_t,
 template void Dmx::SetTransmitDataWithoutSC<dmx::SendStyle::kDirect>(const uint32_t, const uint8_t*, uint32_t);
 template void Dmx::SetTransmitDataWithoutSC<dmx::SendStyle::kSync>(const uint32_t, const uint8_t*, uint32_t);
 
+template void Dmx::SwapTransmitBuffer<dmx::SendStyle::kDirect>(uint32_t, uint32_t);
+template void Dmx::SwapTransmitBuffer<dmx::SendStyle::kSync>(uint32_t, uint32_t);
+
 template void Dmx::SetSendDataInternal<0, true, dmx::SendStyle::kDirect>(const uint8_t*, uint32_t);
 template void Dmx::SetSendDataInternal<0, true, dmx::SendStyle::kSync>(const uint8_t*, uint32_t);
 template void Dmx::SetSendDataInternal<0, false, dmx::SendStyle::kDirect>(const uint8_t*, uint32_t);
@@ -2261,64 +2632,95 @@ template void Dmx::SetSendDataInternal<7, false, dmx::SendStyle::kSync>(const ui
 // Configuration
 [[gnu::noinline]]
 void Dmx::SetTransmitBreakTime(uint32_t break_time) {
-    s_dmx_transmit.break_time = std::max(dmx::transmit::kBreakTimeMin, break_time);
-    SetTransmitPeriodTime(transmit_period_requested_);
+    for (uint32_t port_index = 0; port_index < dmx::config::max::kPorts; port_index++) {
+        SetTransmitBreakTime(port_index, break_time);
+    }
 }
 
 [[gnu::noinline]]
-uint32_t Dmx::TransmitBreakTime() const {
-    return s_dmx_transmit.break_time;
+void Dmx::SetTransmitBreakTime(uint32_t port_index, uint32_t break_time) {
+    DMX_CHECK_PORT_INDEX_VOID(port_index);
+    s_dmx_transmit[port_index].break_time = std::max(dmx::transmit::kBreakTimeMin, break_time);
+    TransmitTimingUpdate(port_index);
+}
+
+[[gnu::noinline]]
+uint32_t Dmx::TransmitBreakTime(uint32_t port_index) const {
+    DMX_CHECK_PORT_INDEX_RET(port_index, 0);
+    return s_dmx_transmit[port_index].break_time;
 }
 
 [[gnu::noinline]]
 void Dmx::SetTransmitMabTime(uint32_t mab_time) {
-    s_dmx_transmit.mab_time = std::max(dmx::transmit::kMabTimeMin, mab_time);
-    SetTransmitPeriodTime(transmit_period_requested_);
+    for (uint32_t port_index = 0; port_index < dmx::config::max::kPorts; port_index++) {
+        SetTransmitMabTime(port_index, mab_time);
+    }
 }
 
 [[gnu::noinline]]
-uint32_t Dmx::TransmitMabTime() const {
-    return s_dmx_transmit.mab_time;
+void Dmx::SetTransmitMabTime(uint32_t port_index, uint32_t mab_time) {
+    DMX_CHECK_PORT_INDEX_VOID(port_index);
+    s_dmx_transmit[port_index].mab_time = std::max(dmx::transmit::kMabTimeMin, mab_time);
+    TransmitTimingUpdate(port_index);
+}
+
+[[gnu::noinline]]
+uint32_t Dmx::TransmitMabTime(uint32_t port_index) const {
+    DMX_CHECK_PORT_INDEX_RET(port_index, 0);
+    return s_dmx_transmit[port_index].mab_time;
 }
 
 [[gnu::noinline]]
 void Dmx::SetTransmitPeriodTime(uint32_t period) {
-    transmit_period_requested_ = period;
+    for (uint32_t port_index = 0; port_index < dmx::config::max::kPorts; port_index++) {
+        SetTransmitPeriodTime(port_index, period);
+    }
+}
 
-    auto length_max = s_DmxTxBuffer[0].dmx.data[0].length;
+[[gnu::noinline]]
+void Dmx::SetTransmitPeriodTime(uint32_t port_index, uint32_t period) {
+    DMX_CHECK_PORT_INDEX_VOID(port_index);
+    s_dmx_transmit[port_index].period_requested = period;
+    TransmitTimingUpdate(port_index);
+}
 
-    for (uint32_t port_index = 1; port_index < dmx::config::max::kPorts; port_index++) {
-        const auto kLength = s_DmxTxBuffer[port_index].dmx.data[0].length;
-        if (kLength > length_max) {
-            length_max = kLength;
-        }
-    }
+[[gnu::noinline]]
+uint32_t Dmx::TransmitPeriodTime(uint32_t port_index) const {
+    DMX_CHECK_PORT_INDEX_RET(port_index, 0);
+    return s_dmx_transmit[port_index].period;
+}
+
+/**
+ * Each port has its own timer compare channel, so the break, MAB and
+ * inter packet time only depend on the settings and slot count of that port.
+ */
+[[gnu::noinline]]
+void Dmx::TransmitTimingUpdate(uint32_t port_index) {
+    auto& transmit = s_dmx_transmit[port_index];
+    const auto kPeriod = transmit.period_requested;
+    const auto kLength = transmit_length_[port_index] + 1U; // Including START Code
 
-    auto package_length_micro_seconds = s_dmx_transmit.break_time + s_dmx_transmit.mab_time + (length_max * dmx::kSlotTime);
+    auto package_length_micro_seconds = transmit.break_time + transmit.mab_time + (kLength * dmx::kSlotTime);
 
     // The GD32F4xx/GD32H7XX Timer 1 has a 32-bit counter
 #if defined(GD32F4XX) || defined(GD32H7XX)
 #else
     if (package_length_micro_seconds > (UINT16_MAX - dmx::kSlotTime)) {
-        s_dmx_transmit.break_time = std::min(dmx::transmit::kBreakTimeTypical, s_dmx_transmit.break_time);
-        s_dmx_transmit.mab_time = dmx::transmit::kMabTimeMin;
-        package_length_micro_seconds = s_dmx_transmit.break_time + s_dmx_transmit.mab_time + (length_max * dmx::kSlotTime);
+        transmit.break_time = std::min(dmx::transmit::kBreakTimeTypical, transmit.break_time);
+        transmit.mab_time = dmx::transmit::kMabTimeMin;
+        package_length_micro_seconds = transmit.break_time + transmit.mab_time + (kLength * dmx::kSlotTime);
     }
 #endif // defined(GD32F4XX) || defined(GD32H7XX)
 
-    if (period != 0) {
-        if (period < package_length_micro_seconds) {
-            transmit_period_ = std::max(dmx::transmit::kBreakToBreakTimeMin, package_length_micro_seconds + dmx::kSlotTime);
-        } else {
-            transmit_period_ = period;
-        }
+    if ((kPeriod != 0) && (kPeriod >= package_length_micro_seconds)) {
+        transmit.period = kPeriod;
     } else {
-        transmit_period_ = std::max(dmx::transmit::kBreakToBreakTimeMin, package_length_micro_seconds + dmx::kSlotTime);
+        transmit.period = std::max(dmx::transmit::kBreakToBreakTimeMin, package_length_micro_seconds + dmx::kSlotTime);
     }
 
-    s_dmx_transmit.inter_time = transmit_period_ - package_length_micro_seconds;
+    transmit.inter_time = transmit.period - package_length_micro_seconds;
 
-    DMX_DEBUG_PRINTF("period=%u, length_max=%u, transmit_period_=%u, package_length_micro_seconds=%u -> s_dmx_transmit.inter_time=%u", period, length_max, transmit_period_, package_length_micro_seconds, s_dmx_transmit.inter_time);
+    DMX_DEBUG_PRINTF("port_index=%u, period=%u, length=%u, package_length_micro_seconds=%u -> period=%u, inter_time=%u", port_index, kPeriod, kLength, package_length_micro_seconds, transmit.period, transmit.inter_time);
 }
 
 [[gnu::noinline]]
@@ -2326,11 +2728,10 @@ void Dmx::SetTransmitSlots(uint16_t slots) {
     if ((slots >= 2) && (slots <= dmx::kChannelsMax)) {
         transmit_slots_ = slots;
 
-        for (uint32_t i = 0; i < dmx::config::max::kPorts; i++) {
-            transmit_length_[i] = static_cast<uint32_t>(slots);
+        for (uint32_t port_index = 0; port_index < dmx::config::max::kPorts; port_index++) {
+            transmit_length_[port_index] = static_cast<uint32_t>(slots);
+            TransmitTimingUpdate(port_index);
         }
-
-        SetTransmitPeriodTime(transmit_period_requested_);
     }
 }
 
@@ -2382,6 +2783,30 @@ static void UartDmxConfig(uint32_t usart_periph) {
     gd32::UartBegin(usart_periph, dmx::kBaudRate, gd32::kUartBits8, gd32::kUartParityNone, gd32::kUartStop2Bits);
 }
 
+#if defined(CONFIG_DMX_RX_DMA) && !defined(CONFIG_DMX_TRANSMIT_ONLY)
+template <uint32_t kUsartPeripheral>
+static void UsartDmaRxConfig() {
+    constexpr auto kRxDma = GetRxDmaByUart(kUsartPeripheral);
+
+    if constexpr (kRxDma.available) {
+        DMA_PARAMETER_STRUCT dma_init_struct;
+        dma_deinit(kRxDma.dma, kRxDma.channel);
+        dma_init_struct.direction = DMA_PERIPHERAL_TO_MEMORY;
+        dma_init_struct.memory_addr = reinterpret_cast<uint32_t>(s_rx_dma_buffer[GetPortByUart(kUsartPeripheral)]);
+        dma_init_struct.memory_inc = DMA_MEMORY_INCREASE_ENABLE;
+        dma_init_struct.memory_width = DMA_MEMORY_WIDTH_8BIT;
+        dma_init_struct.number = dmx::buffer::kSize;
+        dma_init_struct.periph_addr = reinterpret_cast<uint32_t>(&USART_RDATA(kUsartPeripheral));
+        dma_init_struct.periph_inc = DMA_PERIPH_INCREASE_DISABLE;
+        dma_init_struct.periph_width = DMA_PERIPHERAL_WIDTH_8BIT;
+        dma_init_struct.priority = DMA_PRIORITY_ULTRA_HIGH;
+        dma_init(kRxDma.dma, kRxDma.channel, &dma_init_struct);
+        dma_circulation_disable(kRxDma.dma, kRxDma.channel);
+        dma_memory_to_memory_disable(kRxDma.dma, kRxDma.channel);
+    }
+}
+#endif // defined(CONFIG_DMX_RX_DMA) && !defined(CONFIG_DMX_TRANSMIT_ONLY)
+
 static void UsartDmaConfig() {
     DMA_PARAMETER_STRUCT dma_init_struct;
     rcu_periph_clock_enable(RCU_DMA0);
@@ -2669,6 +3094,28 @@ static void UsartDmaConfig() {
     NVIC_EnableIRQ(DMA0_Channel0_IRQn);
 #endif // defined(GD32F20X)
 #endif // defined(DMX_USE_UART7)
+
+#if defined(CONFIG_DMX_RX_DMA) && !defined(CONFIG_DMX_TRANSMIT_ONLY)
+    // DMX/RDM receive, no DMA interrupts: the frames are delimited by the USART break and idle line interrupts
+#if defined(DMX_USE_USART0) || defined(DMX_USE_USART0_RX)
+    UsartDmaRxConfig<USART0>();
+#endif // defined(DMX_USE_USART0) || defined(DMX_USE_USART0_RX)
+#if defined(DMX_USE_USART1) || defined(DMX_USE_USART1_RX)
+    UsartDmaRxConfig<USART1>();
+#endif // defined(DMX_USE_USART1) || defined(DMX_USE_USART1_RX)
+#if defined(DMX_USE_USART2) || defined(DMX_USE_USART2_RX)
+    UsartDmaRxConfig<USART2>();
+#endif // defined(DMX_USE_USART2) || defined(DMX_USE_USART2_RX)
+#if defined(DMX_USE_UART3) || defined(DMX_USE_UART3_RX)
+    UsartDmaRxConfig<UART3>();
+#endif // defined(DMX_USE_UART3) || defined(DMX_USE_UART3_RX)
+#if defined(DMX_USE_UART4) || defined(DMX_USE_UART4_RX)
+    UsartDmaRxConfig<UART4>();
+#endif // defined(DMX_USE_UART4) || defined(DMX_USE_UART4_RX)
+#if defined(DMX_USE_USART5) || defined(DMX_USE_USART5_RX)
+    UsartDmaRxConfig<USART5>();
+#endif // defined(DMX_USE_USART5) || defined(DMX_USE_USART5_RX)
+#endif // defined(CONFIG_DMX_RX_DMA) && !defined(CONFIG_DMX_TRANSMIT_ONLY)
 }
 
 static void Timer1Config() {
@@ -2774,11 +3221,13 @@ Dmx::Dmx() {
     assert(s_this == nullptr);
     s_this = this;
 
-    s_dmx_transmit.break_time = dmx::transmit::kBreakTimeTypical;
-    s_dmx_transmit.mab_time = dmx::transmit::kMabTimeMin;
-    s_dmx_transmit.inter_time = dmx::transmit::kPeriodDefault - s_dmx_transmit.break_time - s_dmx_transmit.mab_time - (dmx::kChannelsMax * dmx::kSlotTime) - dmx::kSlotTime;
-
     for (uint32_t port_index = 0; port_index < dmx::config::max::kPorts; port_index++) {
+        auto& transmit = s_dmx_transmit[port_index];
+        transmit.break_time = dmx::transmit::kBreakTimeTypical;
+        transmit.mab_time = dmx::transmit::kMabTimeMin;
+        transmit.period = dmx::transmit::kPeriodDefault;
+        transmit.inter_time = dmx::transmit::kPeriodDefault - transmit.break_time - transmit.mab_time - (dmx::kChannelsMax * dmx::kSlotTime) - dmx::kSlotTime;
+
         transmit_length_[port_index] = dmx::kChannelsMax;
         sv_rx_buffer[port_index].state = dmx::TxRxState::kIdle;
         s_DmxTxBuffer[port_index].state = dmx::TxRxState::kIdle;
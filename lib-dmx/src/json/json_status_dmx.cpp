@@ -29,6 +29,35 @@
 
 namespace json::status
 {
+/*
+ * snprintf returns the length it would have written, so the length is
+ * clamped when the output is truncated. The result then fills the buffer.
+ */
+static uint32_t Clamp(uint32_t length, uint32_t out_buffer_size) {
+    return (length < out_buffer_size) ? length : out_buffer_size - 1;
+}
+
+static uint32_t Histogram(char* out_buffer, uint32_t out_buffer_size, const volatile uint32_t* buckets) {
+    if (out_buffer_size < 2) {
+        return 0;
+    }
+
+    out_buffer[0] = '[';
+    uint32_t length = 1;
+
+    for (uint32_t i = 0; i < ::dmx::RdmTiming::kBuckets; i++) {
+        length += static_cast<uint32_t>(snprintf(&out_buffer[length], out_buffer_size - length, "%u,", static_cast<unsigned int>(buckets[i])));
+
+        if (length >= out_buffer_size) {
+            return out_buffer_size - 1;
+        }
+    }
+
+    out_buffer[length - 1] = ']';
+
+    return length;
+}
+
 uint32_t Dmx(char* out_buffer, uint32_t out_buffer_size, uint32_t port_index) {
     if (port_index < ::dmx::config::max::kPorts)
     {
@@ -36,10 +65,18 @@ uint32_t Dmx(char* out_buffer, uint32_t out_buffer_size, uint32_t port_index) {
         auto length = static_cast<uint32_t>(snprintf(out_buffer, out_buffer_size,
          "{\"port\":\"%c\","
          "\"dmx\":{\"sent\":\"%u\",\"received\":\"%u\"},"
-         "\"rdm\":{\"sent\":{\"class\":\"%u\",\"discovery\":\"%u\"},\"received\":{\"good\":\"%u\",\"bad\":\"%u\",\"discovery\":\"%u\"}}}",
+         "\"rdm\":{\"sent\":{\"class\":\"%u\",\"discovery\":\"%u\"},\"received\":{\"good\":\"%u\",\"bad\":\"%u\",\"discovery\":\"%u\"},"
+         "\"timing\":{\"min\":\"%u\",\"max\":\"%u\",\"timeout\":\"%u\",\"response\":",
          static_cast<char>('A' + port_index), static_cast<unsigned int>(statistics.dmx.sent), static_cast<unsigned int>(statistics.dmx.received),
          static_cast<unsigned int>(statistics.rdm.sent.classes), static_cast<unsigned int>(statistics.rdm.sent.discovery_response), static_cast<unsigned int>(statistics.rdm.received.good),
-         static_cast<unsigned int>(statistics.rdm.received.bad), static_cast<unsigned int>(statistics.rdm.received.discovery_response)));
+         static_cast<unsigned int>(statistics.rdm.received.bad), static_cast<unsigned int>(statistics.rdm.received.discovery_response),
+         static_cast<unsigned int>(statistics.rdm.timing.response_min), static_cast<unsigned int>(statistics.rdm.timing.response_max), static_cast<unsigned int>(statistics.rdm.timing.timeout)));
+
+        length = Clamp(length, out_buffer_size);
+        length += Histogram(&out_buffer[length], out_buffer_size - length, statistics.rdm.timing.response);
+        length = Clamp(length + static_cast<uint32_t>(snprintf(&out_buffer[length], out_buffer_size - length, ",\"break\":")), out_buffer_size);
+        length += Histogram(&out_buffer[length], out_buffer_size - length, statistics.rdm.timing.break_to_data);
+        length = Clamp(length + static_cast<uint32_t>(snprintf(&out_buffer[length], out_buffer_size - length, "}}}")), out_buffer_size);
 
         return length;
     }
@@ -67,6 +67,14 @@ inline constexpr uint32_t kDmxportOffset = CONFIG_DMXNODE_DMX_PORT_OFFSET; // Fr
 
 inline constexpr uint32_t kConfigPortCount = ((kMaxPorts - kDmxportOffset) <= common::store::dmxnode::kParamPorts) ? (kMaxPorts - kDmxportOffset) : common::store::dmxnode::kParamPorts;
 
+#if !defined(CONFIG_DMXNODE_MERGE_SOURCES)
+inline constexpr uint32_t kMergeSources = 2;
+#else
+inline constexpr uint32_t kMergeSources = CONFIG_DMXNODE_MERGE_SOURCES; // From build config
+#endif
+
+static_assert((kMergeSources >= 2) && (kMergeSources <= 32), "CONFIG_DMXNODE_MERGE_SOURCES must be in the range 2 to 32");
+
 enum class Personality { kArtnet, kSacn, kNode };
 
 enum class MergeMode { kHtp, kLtp };
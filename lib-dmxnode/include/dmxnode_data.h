@@ -41,6 +41,33 @@ inline void DataOutput(DmxNodeOutputType* const kDmxNodeOutputType, uint32_t por
     assert(kDmxNodeOutputType != nullptr);
     kDmxNodeOutputType->SetData<true>(port_index, dmxnode::Data::Backup(port_index), dmxnode::Data::GetLength(port_index));
 }
+
+/*
+ * The DMX output hands out its transmit buffer, the merge writes straight into it.
+ * Returns nullptr when the output has none, the data is then copied by DataOutput.
+ */
+inline uint8_t* DataTransmitBuffer([[maybe_unused]] DmxNodeOutputType* const kDmxNodeOutputType, [[maybe_unused]] uint32_t port_index) {
+    assert(kDmxNodeOutputType != nullptr);
+#if defined(DMXNODE_OUTPUT_DMX) && !defined(DMXNODE_OUTPUT_PIXEL_DMX)
+    return kDmxNodeOutputType->GetTransmitBuffer(port_index);
+#else
+    return nullptr;
+#endif
+}
+
+/*
+ * The transmit buffer is taken from DataTransmitBuffer, when not nullptr it already holds the merged data.
+ */
+inline void DataOutput(DmxNodeOutputType* const kDmxNodeOutputType, uint32_t port_index, [[maybe_unused]] const uint8_t* transmit) {
+#if defined(DMXNODE_OUTPUT_DMX) && !defined(DMXNODE_OUTPUT_PIXEL_DMX)
+    if (transmit != nullptr) {
+        assert(kDmxNodeOutputType != nullptr);
+        kDmxNodeOutputType->SwapTransmitBuffer(port_index, dmxnode::Data::GetLength(port_index));
+        return;
+    }
+#endif
+    DataOutput(kDmxNodeOutputType, port_index);
+}
 } // namespace dmxnode
 
 #endif // DMXNODE_DATA_H_
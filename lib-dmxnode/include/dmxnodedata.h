@@ -54,13 +54,36 @@ class Data {
         return instance;
     }
 
-    static void SetSourceA(uint32_t port_index, const uint8_t* data, uint32_t length) { Get().IMergeSourceA(port_index, data, length, MergeMode::kLtp); }
+    /*
+     * The source is the only one sending to the port: store and output as is.
+     * With a transmit buffer (see dmxnode::DataTransmitBuffer) the output is written into it as well.
+     */
+    static void SetSource(uint32_t port_index, uint32_t source_index, const uint8_t* data, uint32_t length, uint8_t* transmit = nullptr) {
+        Get().ISetSource(port_index, source_index, data, length, transmit);
+    }
+
+    static void MergeSource(uint32_t port_index, uint32_t source_index, const uint8_t* data, uint32_t length, MergeMode merge_mode, uint8_t* transmit = nullptr) {
+        Get().IMergeSource(port_index, source_index, data, length, merge_mode, transmit);
+    }
 
-    static void MergeSourceA(uint32_t port_index, const uint8_t* data, uint32_t length, MergeMode merge_mode) { Get().IMergeSourceA(port_index, data, length, merge_mode); }
+    /*
+     * The source is no longer sending (timeout, stream terminated).
+     * With HTP only the slots the source contributed to are merged again from the remaining sources.
+     */
+    static void ReleaseSource(uint32_t port_index, uint32_t source_index, MergeMode merge_mode) { Get().IReleaseSource(port_index, source_index, merge_mode); }
 
-    static void SetSourceB(uint32_t port_index, const uint8_t* data, uint32_t length) { Get().IMergeSourceB(port_index, data, length, MergeMode::kLtp); }
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+    /*
+     * With slot priority enabled, the HTP merge takes per slot the highest priority sources only.
+     * Slots with priority 0 are not sourced.
+     */
+    static void SetSlotPriority(uint32_t port_index, bool is_enabled) { Get().ISetSlotPriority(port_index, is_enabled); }
 
-    static void MergeSourceB(uint32_t port_index, const uint8_t* data, uint32_t length, MergeMode merge_mode) { Get().IMergeSourceB(port_index, data, length, merge_mode); }
+    // The same priority for all slots
+    static void SetSourcePriority(uint32_t port_index, uint32_t source_index, uint8_t priority) { Get().ISetSourcePriority(port_index, source_index, priority); }
+
+    static void SetSourcePriority(uint32_t port_index, uint32_t source_index, const uint8_t* priority, uint32_t length) { Get().ISetSourcePriority(port_index, source_index, priority, length); }
+#endif
 
     static void Clear(uint32_t port_index) { Get().IClear(port_index); }
 
@@ -73,51 +96,250 @@ class Data {
     static void Restore(uint32_t port_index, const uint8_t* data) { Get().IRestore(port_index, data); }
 
    private:
-    void IMergeSourceA(uint32_t port_index, const uint8_t* data, uint32_t length, MergeMode merge_mode) {
+    struct OutputPort;
+
+    void ISetSource(uint32_t port_index, uint32_t source_index, const uint8_t* data, uint32_t length, uint8_t* transmit) {
         assert(port_index < kPorts);
+        assert(source_index < dmxnode::kMergeSources);
         assert(data != nullptr);
 
-        memcpy(output_port_[port_index].source_a.data, data, length);
+        auto& output_port = output_port_[port_index];
+
+        output_port.length = length;
+
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+        if (output_port.is_slot_priority) {
+            MergePrioritySource(output_port, 1U << source_index, source_index, data, length);
+            Transmit(output_port, transmit, length);
+            return;
+        }
+#endif
+
+        memcpy(output_port.source[source_index].data, data, length);
+        output_port.active = 1U << source_index;
+
+        memcpy(output_port.data, data, length);
+        output_port.is_htp_valid = true;
+
+        if (transmit != nullptr) {
+            memcpy(transmit, data, length);
+        }
+    }
 
-        output_port_[port_index].length = length;
+    void IMergeSource(uint32_t port_index, uint32_t source_index, const uint8_t* data, uint32_t length, MergeMode merge_mode, uint8_t* transmit) {
+        assert(port_index < kPorts);
+        assert(source_index < dmxnode::kMergeSources);
+        assert(data != nullptr);
+
+        auto& output_port = output_port_[port_index];
+        output_port.length = length;
 
         if (merge_mode == MergeMode::kHtp) {
-            for (uint32_t i = 0; i < length; i++) {
-                const auto kData = std::max(output_port_[port_index].source_a.data[i], output_port_[port_index].source_b.data[i]);
-                output_port_[port_index].data[i] = kData;
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+            if (output_port.is_slot_priority) {
+                MergePrioritySource(output_port, output_port.active | (1U << source_index), source_index, data, length);
+                Transmit(output_port, transmit, length);
+                return;
             }
+#endif
+            MergeHtp(output_port, source_index, data, length, transmit);
+            return;
+        }
+
+        output_port.active |= 1U << source_index;
+        output_port.is_htp_valid = false;
+
+        memcpy(output_port.source[source_index].data, data, length);
+        memcpy(output_port.data, data, length);
+
+        if (transmit != nullptr) {
+            memcpy(transmit, data, length);
+        }
+    }
+
+    void IReleaseSource(uint32_t port_index, uint32_t source_index, MergeMode merge_mode) {
+        assert(port_index < kPorts);
+        assert(source_index < dmxnode::kMergeSources);
+
+        auto& output_port = output_port_[port_index];
+        const auto kSource = 1U << source_index;
 
+        if ((output_port.active & kSource) == 0) {
+            return;
+        }
+
+        output_port.active &= ~kSource;
+
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+        if ((merge_mode == MergeMode::kHtp) && output_port.is_slot_priority && (output_port.active != 0)) {
+            MergePriority(output_port);
+            return;
+        }
+#endif
+        // Without any source left, the last output is kept
+        if ((merge_mode != MergeMode::kHtp) || (output_port.active == 0) || !output_port.is_htp_valid) {
             return;
         }
 
-        memcpy(output_port_[port_index].data, data, length);
+        const auto* source32 = reinterpret_cast<const uint32_t*>(output_port.source[source_index].data);
+        auto* output32 = reinterpret_cast<uint32_t*>(output_port.data);
+        // The other sources may have sent more slots than the latest length
+        for (uint32_t i = 0; i < dmxnode::kUniverseSize / 4; i++) {
+            if (HasZeroByte(source32[i] ^ output32[i])) {
+                output32[i] = MaxActive(output_port, i);
+            }
+        }
     }
 
-    void IMergeSourceB(uint32_t port_index, const uint8_t* data, uint32_t length, MergeMode merge_mode) {
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+    void ISetSlotPriority(uint32_t port_index, bool is_enabled) {
         assert(port_index < kPorts);
-        assert(data != nullptr);
 
-        memcpy(output_port_[port_index].source_b.data, data, length);
+        output_port_[port_index].is_slot_priority = is_enabled;
+        output_port_[port_index].is_htp_valid = false;
+    }
+
+    void ISetSourcePriority(uint32_t port_index, uint32_t source_index, uint8_t priority) {
+        assert(port_index < kPorts);
+        assert(source_index < dmxnode::kMergeSources);
 
-        output_port_[port_index].length = length;
+        auto& output_port = output_port_[port_index];
+        auto& source = output_port.source[source_index];
 
-        if (merge_mode == MergeMode::kHtp) {
-            for (uint32_t i = 0; i < length; i++) {
-                const auto kData = std::max(output_port_[port_index].source_a.data[i], output_port_[port_index].source_b.data[i]);
-                output_port_[port_index].data[i] = kData;
+        if (source.priority_uniform != priority) {
+            source.priority_uniform = priority;
+            memset(source.priority, priority, dmxnode::kUniverseSize);
+            output_port.is_htp_valid = false;
+        }
+    }
+
+    void ISetSourcePriority(uint32_t port_index, uint32_t source_index, const uint8_t* priority, uint32_t length) {
+        assert(port_index < kPorts);
+        assert(source_index < dmxnode::kMergeSources);
+        assert(priority != nullptr);
+        assert(length <= dmxnode::kUniverseSize);
+
+        auto& output_port = output_port_[port_index];
+        auto& source = output_port.source[source_index];
+
+        // The priorities are sent about once a second, mostly unchanged
+        if ((source.priority_uniform == kPriorityPerSlot) && (memcmp(source.priority, priority, length) == 0) && IsZero(&source.priority[length], dmxnode::kUniverseSize - length)) {
+            return;
+        }
+
+        source.priority_uniform = kPriorityPerSlot;
+        memcpy(source.priority, priority, length);
+        memset(&source.priority[length], 0, dmxnode::kUniverseSize - length);
+        output_port.is_htp_valid = false;
+    }
+
+    static bool IsZero(const uint8_t* p, uint32_t length) {
+        for (uint32_t i = 0; i < length; i++) {
+            if (p[i] != 0) {
+                return false;
             }
+        }
 
+        return true;
+    }
+
+    static constexpr uint32_t kPriorityPerSlot = 0x100;
+
+    /*
+     * 0xFF in each byte where a and b are equal.
+     */
+    static uint32_t EqualMaskU8x4(uint32_t a, uint32_t b) {
+        const auto kDiff = a ^ b;
+        const auto kNonZero = ((kDiff & 0x7F7F7F7FU) + 0x7F7F7F7FU) | kDiff;
+        const auto kZero = ~kNonZero & 0x80808080U;
+        return (kZero - (kZero >> 7)) | kZero;
+    }
+
+    /*
+     * HTP of word_index over the active sources with the highest priority per slot.
+     */
+    static uint32_t MergePriorityWord(const OutputPort& output_port, uint32_t word_index) {
+        uint32_t priority_max = 0;
+
+        for (auto active = output_port.active; active != 0; active &= (active - 1)) {
+            const auto* priority32 = reinterpret_cast<const uint32_t*>(output_port.source[__builtin_ctz(active)].priority);
+            priority_max = MaxU8x4(priority_max, priority32[word_index]);
+        }
+
+        uint32_t value = 0;
+
+        for (auto active = output_port.active; active != 0; active &= (active - 1)) {
+            const auto& source = output_port.source[__builtin_ctz(active)];
+            const auto kMask = EqualMaskU8x4(reinterpret_cast<const uint32_t*>(source.priority)[word_index], priority_max);
+            value = MaxU8x4(value, reinterpret_cast<const uint32_t*>(source.data)[word_index] & kMask);
+        }
+
+        return value & ~EqualMaskU8x4(priority_max, 0);
+    }
+
+    static void MergePriority(OutputPort& output_port) {
+        auto* output32 = reinterpret_cast<uint32_t*>(output_port.data);
+
+        for (uint32_t i = 0; i < dmxnode::kUniverseSize / 4; i++) {
+            output32[i] = MergePriorityWord(output_port, i);
+        }
+
+        output_port.is_htp_valid = true;
+    }
+
+    /*
+     * Stores the new source data. While the merge is valid and the active sources are
+     * the same, only the words in which the data changed are merged again. A change of
+     * the sources or of a priority merges all words.
+     */
+    // The incremental merge leaves the unchanged words in place, these are copied as well
+    static void Transmit(const OutputPort& output_port, uint8_t* transmit, uint32_t length) {
+        if (transmit != nullptr) {
+            memcpy(transmit, output_port.data, length);
+        }
+    }
+
+    static void MergePrioritySource(OutputPort& output_port, uint32_t active, uint32_t source_index, const uint8_t* data, uint32_t length) {
+        auto* source32 = reinterpret_cast<uint32_t*>(output_port.source[source_index].data);
+
+        if (!output_port.is_htp_valid || (output_port.active != active)) {
+            output_port.active = active;
+            memcpy(source32, data, length);
+            MergePriority(output_port);
             return;
         }
 
-        memcpy(output_port_[port_index].data, data, length);
+        const auto kWords = length / 4;
+        auto* output32 = reinterpret_cast<uint32_t*>(output_port.data);
+
+        for (uint32_t i = 0; i < kWords; i++) {
+            uint32_t word;
+            memcpy(&word, &data[i * 4], sizeof(uint32_t)); // The received data is not always word aligned
+
+            if (word != source32[i]) {
+                source32[i] = word;
+                output32[i] = MergePriorityWord(output_port, i);
+            }
+        }
+
+        if ((length & 3) != 0) {
+            auto word = source32[kWords];
+            memcpy(&word, &data[kWords * 4], length & 3);
+
+            if (word != source32[kWords]) {
+                source32[kWords] = word;
+                output32[kWords] = MergePriorityWord(output_port, kWords);
+            }
+        }
     }
+#endif
 
     void IClear(uint32_t port_index) {
         assert(port_index < kPorts);
 
         memset(output_port_[port_index].data, 0, dmxnode::kUniverseSize);
         output_port_[port_index].length = dmxnode::kUniverseSize;
+        output_port_[port_index].is_htp_valid = false;
     }
 
     void IClearLength(uint32_t port_index) {
@@ -140,6 +362,90 @@ class Data {
         assert(data != nullptr);
 
         memcpy(output_port_[port_index].data, data, dmxnode::kUniverseSize);
+        output_port_[port_index].is_htp_valid = false;
+    }
+
+    /*
+     * Per byte unsigned maximum of 4 slots packed in a word.
+     */
+    static uint32_t MaxU8x4(uint32_t a, uint32_t b) {
+#if defined(__ARM_FEATURE_DSP)
+        uint32_t result;
+        __asm__("usub8 %0, %1, %2\n\tsel %0, %1, %2" : "=&r"(result) : "r"(a), "r"(b) : "cc");
+        return result;
+#else
+        constexpr uint32_t kHigh = 0x80808080U;
+        // Bit 7 of each byte is set when the low 7 bits of a are >= the low 7 bits of b
+        const auto kLow = (a | kHigh) - (b & ~kHigh);
+        const auto kGreaterEqual = ((a & ~b) | (~(a ^ b) & kLow)) & kHigh;
+        const auto kMask = (kGreaterEqual - (kGreaterEqual >> 7)) | kGreaterEqual;
+        return (a & kMask) | (b & ~kMask);
+#endif
+    }
+
+    static bool HasZeroByte(uint32_t v) { return ((v - 0x01010101U) & ~v & 0x80808080U) != 0; }
+
+    /*
+     * HTP of word_index over all active sources.
+     */
+    static uint32_t MaxActive(const OutputPort& output_port, uint32_t word_index) {
+        uint32_t result = 0;
+
+        for (auto active = output_port.active; active != 0; active &= (active - 1)) {
+            const auto* source32 = reinterpret_cast<const uint32_t*>(output_port.source[__builtin_ctz(active)].data);
+            result = MaxU8x4(result, source32[word_index]);
+        }
+
+        return result;
+    }
+
+    /*
+     * Stores the new source data and updates the HTP output in a single pass.
+     * A word is merged from all active sources only when a slot of this source went down,
+     * otherwise the maximum of the new data and the current output is sufficient.
+     * The merged words go into the transmit buffer, when given, in the same pass.
+     */
+    static void MergeHtp(OutputPort& output_port, uint32_t source_index, const uint8_t* data, uint32_t length, uint8_t* transmit) {
+        const auto kSource = 1U << source_index;
+        const auto kIsNew = (output_port.active & kSource) == 0;
+        const auto kIsValid = output_port.is_htp_valid && (output_port.active != 0);
+
+        output_port.active |= kSource;
+        output_port.is_htp_valid = true;
+
+        const auto kWords = length / 4;
+        auto* source32 = reinterpret_cast<uint32_t*>(output_port.source[source_index].data);
+        auto* output32 = reinterpret_cast<uint32_t*>(output_port.data);
+
+        for (uint32_t i = 0; i < kWords; i++) {
+            const auto kPrevious = kIsNew ? 0 : source32[i];
+            uint32_t word;
+            memcpy(&word, &data[i * 4], sizeof(uint32_t)); // The received data is not always word aligned
+            source32[i] = word;
+            output32[i] = MergeHtpWord(output_port, i, kPrevious, word, kIsValid);
+
+            if (transmit != nullptr) {
+                memcpy(&transmit[i * 4], &output32[i], sizeof(uint32_t)); // The transmit buffer follows the START Code
+            }
+        }
+
+        if ((length & 3) != 0) {
+            const auto kPrevious = kIsNew ? 0 : source32[kWords];
+            memcpy(&source32[kWords], &data[kWords * 4], length & 3);
+            output32[kWords] = MergeHtpWord(output_port, kWords, kPrevious, source32[kWords], kIsValid);
+
+            if (transmit != nullptr) {
+                memcpy(&transmit[kWords * 4], &output32[kWords], length & 3);
+            }
+        }
+    }
+
+    static uint32_t MergeHtpWord(const OutputPort& output_port, uint32_t word_index, uint32_t previous, uint32_t word, bool is_valid) {
+        if (is_valid && (MaxU8x4(word, previous) == word)) {
+            return MaxU8x4(word, reinterpret_cast<const uint32_t*>(output_port.data)[word_index]);
+        }
+
+        return MaxActive(output_port, word_index);
     }
 
 #if !defined(DMXNODE_PORTS)
@@ -154,13 +460,21 @@ class Data {
 
     struct Source {
         uint8_t data[dmxnode::kUniverseSize] __attribute__((aligned(4)));
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+        uint8_t priority[dmxnode::kUniverseSize] __attribute__((aligned(4)));
+        uint32_t priority_uniform; ///< kPriorityPerSlot when the priority is per slot
+#endif
     };
 
     struct OutputPort {
-        Source source_a;
-        Source source_b;
+        Source source[dmxnode::kMergeSources];
         uint8_t data[dmxnode::kUniverseSize] __attribute__((aligned(4)));
         uint32_t length;
+        uint32_t active; ///< Bit mask of the sources taking part in the merge
+        bool is_htp_valid; ///< The output is the merge of the active sources, with slot priority as well
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+        bool is_slot_priority;
+#endif
     };
 
     OutputPort output_port_[kPorts];
@@ -0,0 +1,121 @@
+/**
+ * @file dmxnodeportlookup.h
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef DMXNODEPORTLOOKUP_H_
+#define DMXNODEPORTLOOKUP_H_
+
+#include <cstdint>
+#include <cassert>
+
+#include "dmxnode.h"
+
+namespace dmxnode {
+/*
+ * Universe (Art-Net Port-Address, sACN universe) to output ports.
+ * The entries are sorted on universe, Find() is a binary search returning a bit mask of port indexes.
+ * The owner rebuilds the table with Clear() and Add() when the port configuration changes.
+ */
+class PortLookup {
+    static_assert(dmxnode::kMaxPorts <= 32, "The ports are a 32-bit mask");
+
+   public:
+    void Clear() {
+        entries_ = 0;
+        ports_ = 0;
+    }
+
+    void Add(uint32_t port_index, uint16_t universe) {
+        assert(port_index < dmxnode::kMaxPorts);
+
+        const auto kIndex = LowerBound(universe);
+        const auto kPort = 1U << port_index;
+
+        ports_ |= kPort;
+
+        if ((kIndex < entries_) && (entry_[kIndex].universe == universe)) {
+            entry_[kIndex].ports |= kPort;
+            return;
+        }
+
+        assert(entries_ < dmxnode::kMaxPorts);
+
+        for (auto i = entries_; i > kIndex; i--) {
+            entry_[i] = entry_[i - 1];
+        }
+
+        entry_[kIndex].universe = universe;
+        entry_[kIndex].ports = kPort;
+        entries_++;
+    }
+
+    uint32_t Find(uint16_t universe) const {
+        const auto kIndex = LowerBound(universe);
+
+        if ((kIndex < entries_) && (entry_[kIndex].universe == universe)) {
+            return entry_[kIndex].ports;
+        }
+
+        return 0;
+    }
+
+    /*
+     * All ports in the table
+     */
+    uint32_t Ports() const { return ports_; }
+
+    static uint32_t PortIndex(uint32_t ports) { return static_cast<uint32_t>(__builtin_ctz(ports)); }
+
+   private:
+    uint32_t LowerBound(uint16_t universe) const {
+        uint32_t first = 0;
+        uint32_t count = entries_;
+
+        while (count > 0) {
+            const auto kStep = count / 2;
+            const auto kMiddle = first + kStep;
+
+            if (entry_[kMiddle].universe < universe) {
+                first = kMiddle + 1;
+                count -= kStep + 1;
+            } else {
+                count = kStep;
+            }
+        }
+
+        return first;
+    }
+
+   private:
+    struct Entry {
+        uint32_t ports;
+        uint16_t universe;
+    };
+
+    Entry entry_[dmxnode::kMaxPorts];
+    uint32_t entries_{0};
+    uint32_t ports_{0};
+};
+} // namespace dmxnode
+
+#endif // DMXNODEPORTLOOKUP_H_
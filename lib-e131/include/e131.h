@@ -41,6 +41,13 @@ inline constexpr auto kMergeTimeoutSeconds = 10;
 inline constexpr auto kPriorityTimeoutSeconds = 10;
 inline constexpr auto kUniverseDiscoveryIntervalSeconds = 10;
 inline constexpr auto kNetworkDataLossTimeoutSeconds = 2.5f;
+inline constexpr auto kSamplingPeriodMillis = static_cast<uint32_t>(kNetworkDataLossTimeoutSeconds * 1000); ///< E131_NETWORK_DATA_LOSS_TIMEOUT, collecting sources and priorities before the first output
+
+namespace startcode
+{
+inline constexpr uint8_t kDmx = 0x00;
+inline constexpr uint8_t kPerSlotPriority = 0xDD; ///< Per address priority (ETC)
+} // namespace startcode
 
 struct OptionsMask
 {
@@ -31,6 +31,7 @@
 #include "e131.h"
 #include "e131sync.h"
 #include "dmxnode_outputtype.h"
+#include "dmxnodeportlookup.h"
 #include "softwaretimers.h"
 #if defined(NODE_RDMNET_LLRP_ONLY)
 #include "llrp/llrpdevice.h"
@@ -48,13 +49,11 @@ enum StateFlags : uint8_t { kNetworkDataLoss = (1 << 0), kMergeMode = (1 << 1),
 struct State {
     uint8_t enabled_input_ports;
     uint8_t enabled_output_ports;
-    uint8_t priority;
     uint8_t receiving_dmx;
     dmxnode::FailSafe failsafe;
     e131bridge::Status status;
     uint16_t discovery_packet_length;
-    uint16_t synchronization_address_source_a;
-    uint16_t synchronization_address_source_b;
+    uint16_t synchronization_address_source[dmxnode::kMergeSources];
     uint32_t synchronization_time;
     bool is_network_data_loss;
     bool is_merge_mode;
@@ -76,15 +75,24 @@ struct Bridge {
 struct Source {
     uint32_t millis;
     uint32_t ip;
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+    uint32_t slot_priority_millis;
+#endif
     uint8_t cid[e117::kCidLength];
     uint8_t sequence_number_data;
+    uint8_t priority;
 };
 
 struct OutputPort {
-    Source source_a ALIGNED;
-    Source source_b ALIGNED;
+    Source source[dmxnode::kMergeSources] ALIGNED;
+    uint32_t sampling_millis;
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+    uint32_t slot_priority_sources; ///< Bit mask of the sources sending 0xDD
+#endif
     dmxnode::MergeMode merge_mode;
     dmxnode::OutputStyle output_style;
+    uint8_t priority;
+    bool is_sampling;
     bool is_merging;
     bool is_transmitting;
     bool is_data_pending;
@@ -195,12 +203,18 @@ class E131Bridge
    private:
     void InputUdp(const uint8_t* buffer, uint32_t size, uint32_t from_ip, uint16_t from_port);
 
-    void SetNetworkDataLossCondition(bool source_a = true, bool source_b = true);
+    // dmxnode::kMergeSources is for all sources
+    void SetNetworkDataLossCondition(uint32_t source_index = dmxnode::kMergeSources);
 
-    void SetSynchronizationAddress(bool source_a, bool source_b, uint16_t synchronization_address);
+    void SetSynchronizationAddress(uint32_t source_index, uint16_t synchronization_address);
 
+    void ReleaseSource(uint32_t port_index, uint32_t source_index);
     void CheckMergeTimeouts(uint32_t port_index);
     bool IsPriorityTimeOut(uint32_t port_index) const;
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+    void CheckSlotPriorityTimeouts(uint32_t port_index);
+    void ReleaseSlotPriority(uint32_t port_index, uint32_t source_index);
+#endif
     bool IsIpCidMatch(const e131bridge::Source* const kSource) const;
     void UpdateMergeStatus(uint32_t port_index);
 
@@ -209,6 +223,7 @@ class E131Bridge
 
     enum class JoinLeave { kJoin, kLeave };
 
+    void UpdatePortLookup();
     void JoinUniverse(uint32_t port_index, uint16_t universe);
     void LeaveUniverse(uint32_t port_index, uint16_t universe);
 
@@ -232,6 +247,7 @@ class E131Bridge
     e131bridge::Bridge bridge_;
     e131bridge::OutputPort output_port_[dmxnode::kMaxPorts];
     e131bridge::InputPort input_port_[dmxnode::kMaxPorts];
+    dmxnode::PortLookup port_lookup_; ///< Universe to the output ports
 
     bool enable_data_indicator_{true};
 
@@ -50,6 +50,22 @@ struct TE131ControllerState
     } SynchronizationPacket;
 };
 
+namespace e131::controller
+{
+/*
+ * A frame is the data packets sent from the first HandleDmxOut up to HandleSync.
+ */
+struct Counters
+{
+    uint32_t frames;
+    uint32_t packets;
+    uint32_t frame_micros;     ///< Time spent in HandleDmxOut for the last frame
+    uint32_t frame_micros_max;
+    uint32_t spread_micros;    ///< From the first universe up to the end of the last frame
+    uint32_t spread_micros_max;
+};
+} // namespace e131::controller
+
 class E131Controller
 {
    public:
@@ -87,6 +103,8 @@ class E131Controller
 
     const uint8_t* GetSoftwareVersion();
 
+    const e131::controller::Counters& GetCounters() const { return counters_; }
+
     void SetSourceName(const char* pSourceName);
     void SetPriority(uint8_t nPriority);
 
@@ -112,6 +130,10 @@ class E131Controller
     uint8_t cid_[e117::kCidLength];
     char source_name_[e131::kSourceNameLength];
     uint32_t master_{dmxnode::kDmxMaxValue};
+    e131::controller::Counters counters_{};
+    uint32_t frame_start_micros_{0};
+    uint32_t frame_micros_{0};
+    bool is_frame_{false};
     TimerHandle_t timer_handle_send_discovery_packet_{-1};
 
     static inline E131Controller* s_this;
@@ -34,11 +34,14 @@
 #include "board.h"
 #include "network.h"
 #include "softwaretimers.h"
+#include "timing.h"
 #include "firmware/debug/debug_debug.h"
 
 using namespace e131;
 
 static constexpr uint8_t kDeviceSoftwareVersion[] = {1, 0};
+// The root, framing and DMP layer, including the START Code
+static constexpr uint32_t kDataHeaderSize = e131::DataPacketSize(1);
 
 struct TSequenceNumbers
 {
@@ -199,8 +202,23 @@ void E131Controller::FillSynchronizationPacket()
     m_pE131SynchronizationPacket->frame_layer.universe_number = __builtin_bswap16(state_.SynchronizationPacket.nUniverseNumber);
 }
 
+/*
+ * The headers are filled once by FillDataPacket(), only the lengths, the sequence number and
+ * the universe are patched. The packet is then built in the transmit buffer, together with the data.
+ */
 void E131Controller::HandleDmxOut(uint16_t nUniverse, const uint8_t* pDmxData, uint32_t nLength)
 {
+    assert(nLength <= 512);
+
+    const auto kMicrosStart = timing::Micros();
+
+    if (!is_frame_)
+    {
+        is_frame_ = true;
+        frame_start_micros_ = kMicrosStart;
+        frame_micros_ = 0;
+    }
+
     uint32_t ip;
 
     // Root Layer (See Section 5)
@@ -213,28 +231,38 @@ void E131Controller::HandleDmxOut(uint16_t nUniverse, const uint8_t* pDmxData, u
 
     // Data Layer
     m_pE131DataPacket->dmp_layer.flags_length = __builtin_bswap16(static_cast<uint16_t>((0x07 << 12) | (e131::DataLayerLength(1U + nLength))));
+    m_pE131DataPacket->dmp_layer.property_value_count = __builtin_bswap16(static_cast<uint16_t>(1 + nLength));
+
+    auto* buffer = network::udp::GetSendBuffer();
+    memcpy(buffer, m_pE131DataPacket, kDataHeaderSize);
+
+    auto* property_values = &buffer[kDataHeaderSize];
 
     if (__builtin_expect((master_ == dmxnode::kDmxMaxValue), 1))
     {
-        memcpy(&m_pE131DataPacket->dmp_layer.property_values[1], pDmxData, nLength);
+        memcpy(property_values, pDmxData, nLength);
     }
     else if (master_ == 0)
     {
-        memset(&m_pE131DataPacket->dmp_layer.property_values[1], 0, nLength);
+        memset(property_values, 0, nLength);
     }
     else
     {
         for (uint32_t i = 0; i < nLength; i++)
         {
-            m_pE131DataPacket->dmp_layer.property_values[1 + i] = static_cast<uint8_t>((master_ * pDmxData[i]) / dmxnode::kDmxMaxValue);
+            property_values[i] = static_cast<uint8_t>((master_ * pDmxData[i]) / dmxnode::kDmxMaxValue);
         }
     }
 
-    m_pE131DataPacket->dmp_layer.property_value_count = __builtin_bswap16(static_cast<uint16_t>(1 + nLength));
+    network::udp::SendBuffer(handle_, e131::DataPacketSize(1U + nLength), ip, e131::kUdpPort);
 
-    network::udp::Send(handle_, reinterpret_cast<const uint8_t*>(m_pE131DataPacket), static_cast<uint16_t>(e131::DataPacketSize(1U + nLength)), ip, e131::kUdpPort);
+    frame_micros_ += timing::Micros() - kMicrosStart;
+    counters_.packets++;
 }
 
+/*
+ * Ends the frame.
+ */
 void E131Controller::HandleSync()
 {
     if (state_.SynchronizationPacket.nUniverseNumber != 0)
@@ -243,6 +271,29 @@ void E131Controller::HandleSync()
         network::udp::Send(handle_, reinterpret_cast<const uint8_t*>(m_pE131SynchronizationPacket), e131::kSynchronizationPacketSize,
                        state_.SynchronizationPacket.nIpAddress, e131::kUdpPort);
     }
+
+    if (!is_frame_)
+    {
+        return;
+    }
+
+    is_frame_ = false;
+
+    const auto kSpreadMicros = timing::Micros() - frame_start_micros_;
+
+    counters_.frames++;
+    counters_.frame_micros = frame_micros_;
+    counters_.spread_micros = kSpreadMicros;
+
+    if (frame_micros_ > counters_.frame_micros_max)
+    {
+        counters_.frame_micros_max = frame_micros_;
+    }
+
+    if (kSpreadMicros > counters_.spread_micros_max)
+    {
+        counters_.spread_micros_max = kSpreadMicros;
+    }
 }
 
 void E131Controller::HandleBlackout()
@@ -288,8 +339,10 @@ void E131Controller::SetSourceName(const char* pSourceName)
 }
 
 void E131Controller::SetPriority(uint8_t priority)
-{ // TODO (a) SetPriority
+{
     state_.priority = priority;
+    // Start() fills the header with state_.priority, after that the header is patched here
+    m_pE131DataPacket->frame_layer.priority = priority;
 }
 
 void E131Controller::SendDiscoveryPacket()
@@ -65,11 +65,11 @@ E131Bridge::E131Bridge() {
     }
 
     memset(&state_, 0, sizeof(e131bridge::State));
-    state_.priority = e131::priority::kLowest;
     state_.failsafe = dmxnode::FailSafe::kHold;
 
     for (uint32_t i = 0; i < dmxnode::kMaxPorts; i++) {
         memset(&output_port_[i], 0, sizeof(e131bridge::OutputPort));
+        output_port_[i].priority = e131::priority::kLowest;
         memset(&input_port_[i], 0, sizeof(e131bridge::InputPort));
         input_port_[i].priority = 100;
     }
@@ -169,22 +169,14 @@ void E131Bridge::Stop() {
     board::statusled::SetMode(board::statusled::Mode::kOffOff);
 }
 
-void E131Bridge::SetSynchronizationAddress(bool source_a, bool source_b, uint16_t synchronization_address) {
+void E131Bridge::SetSynchronizationAddress(uint32_t source_index, uint16_t synchronization_address) {
     DEBUG_ENTRY();
-    DEBUG_PRINTF("source_a=%d, source_b=%d, synchronization_address=%d", static_cast<unsigned>(source_a), static_cast<unsigned>(source_b), static_cast<unsigned>(synchronization_address));
+    DEBUG_PRINTF("source_index=%u, synchronization_address=%d", static_cast<unsigned>(source_index), static_cast<unsigned>(synchronization_address));
 
+    assert(source_index < dmxnode::kMergeSources);
     assert(synchronization_address != 0);
 
-    uint16_t* synchronization_address_source;
-
-    if (source_a) {
-        synchronization_address_source = &state_.synchronization_address_source_a;
-    } else if (source_b) {
-        synchronization_address_source = &state_.synchronization_address_source_b;
-    } else {
-        DEBUG_EXIT();
-        return; // Just make the compiler happy
-    }
+    auto* synchronization_address_source = &state_.synchronization_address_source[source_index];
 
     if (*synchronization_address_source == 0) {
         *synchronization_address_source = synchronization_address;
@@ -205,6 +197,16 @@ void E131Bridge::SetSynchronizationAddress(bool source_a, bool source_b, uint16_
     DEBUG_EXIT();
 }
 
+void E131Bridge::UpdatePortLookup() {
+    port_lookup_.Clear();
+
+    for (uint32_t port_index = 0; port_index < dmxnode::kMaxPorts; port_index++) {
+        if (bridge_.port[port_index].direction == dmxnode::Direction::kOutput) {
+            port_lookup_.Add(port_index, bridge_.port[port_index].universe);
+        }
+    }
+}
+
 void E131Bridge::JoinUniverse(uint32_t port_index, uint16_t universe) {
     DEBUG_ENTRY();
     DEBUG_PRINTF("port_index=%d, universe=%d", static_cast<unsigned>(port_index), static_cast<unsigned>(universe));
@@ -274,11 +276,11 @@ void E131Bridge::SetLocalMerging() {
 
             if (bridge_.port[input_port_index].universe == bridge_.port[output_port_index].universe) {
                 if (!bridge_.port[output_port_index].local_merge) {
-                    output_port_[output_port_index].source_a.ip = network::kIpaddrLoopback;
-                    DEBUG_PUTS("Local merge Source A");
+                    output_port_[output_port_index].source[0].ip = network::kIpaddrLoopback;
+                    DEBUG_PUTS("Local merge Source 0");
                 } else {
-                    output_port_[output_port_index].source_b.ip = network::kIpaddrLoopback;
-                    DEBUG_PUTS("Local merge Source B");
+                    output_port_[output_port_index].source[1].ip = network::kIpaddrLoopback;
+                    DEBUG_PUTS("Local merge Source 1");
                 }
 
                 DEBUG_PUTS("");
@@ -314,6 +316,7 @@ void E131Bridge::SetUniverse(uint32_t port_index, uint16_t universe) {
 
     bridge_.port[port_index].universe = universe;
     input_port_[port_index].multicast_ip = e131::UniverseToMulticastIp(universe);
+    UpdatePortLookup();
 
 #if defined(E131_HAVE_DMXIN)
     if (state_.status == e131bridge::Status::kOn) {
@@ -382,6 +385,8 @@ void E131Bridge::SetDirection(uint32_t port_index, dmxnode::Direction port_direc
         bridge_.port[port_index].direction = dmxnode::Direction::kOutput;
     }
 
+    UpdatePortLookup();
+
 #if defined(E131_HAVE_DMXIN)
     if (state_.status == e131bridge::Status::kOn) {
         SetLocalMerging();
@@ -494,7 +499,13 @@ void E131Bridge::HandleSynchronization() {
     const auto& synchronization_packet = *reinterpret_cast<const e131::SynchronizationPacket*>(receive_buffer_);
     const auto kSynchronizationAddress = __builtin_bswap16(synchronization_packet.frame_layer.universe_number);
 
-    if ((kSynchronizationAddress != state_.synchronization_address_source_a) && (kSynchronizationAddress != state_.synchronization_address_source_b)) {
+    auto is_synchronization_address = false;
+
+    for (const auto kAddress : state_.synchronization_address_source) {
+        is_synchronization_address |= (kAddress == kSynchronizationAddress);
+    }
+
+    if (!is_synchronization_address) {
         board::statusled::SetMode(board::statusled::Mode::kNormal);
         DEBUG_PUTS("");
         return;
@@ -502,7 +513,8 @@ void E131Bridge::HandleSynchronization() {
 
     state_.synchronization_time = packet_millis_;
 
-    for (uint32_t port_index = 0; port_index < dmxnode::kMaxPorts; port_index++) {
+    for (auto ports = port_lookup_.Ports(); ports != 0; ports &= (ports - 1)) {
+        const auto port_index = dmxnode::PortLookup::PortIndex(ports);
         if (output_port_[port_index].is_data_pending) {
             dmxnode_output_type_->Sync(port_index);
         }
@@ -574,23 +586,47 @@ void E131Bridge::UpdateMergeStatus(uint32_t port_index) {
     output_port_[port_index].is_merging = true;
 }
 
+/*
+ * A source that is gone, by a merge timeout, a network data loss or a higher priority.
+ */
+void E131Bridge::ReleaseSource(uint32_t port_index, uint32_t source_index) {
+    assert(port_index < dmxnode::kMaxPorts);
+    assert(source_index < dmxnode::kMergeSources);
+
+    auto& output_port = output_port_[port_index];
+    auto& source = output_port.source[source_index];
+
+    source.ip = 0;
+    memset(source.cid, 0, e117::kCidLength);
+    dmxnode::Data::ReleaseSource(port_index, source_index, output_port.merge_mode);
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+    ReleaseSlotPriority(port_index, source_index);
+#endif
+}
+
 void E131Bridge::CheckMergeTimeouts(uint32_t port_index) {
     assert(port_index < dmxnode::kMaxPorts);
 
-    const auto kTimeOutA = current_millis_ - output_port_[port_index].source_a.millis;
+    auto& output_port = output_port_[port_index];
+    uint32_t sources_active = 0;
 
-    if (kTimeOutA > (e131::kMergeTimeoutSeconds * 1000U)) {
-        output_port_[port_index].source_a.ip = 0;
-        memset(output_port_[port_index].source_a.cid, 0, e117::kCidLength);
-        output_port_[port_index].is_merging = false;
-    }
+    for (uint32_t source_index = 0; source_index < dmxnode::kMergeSources; source_index++) {
+        auto& source = output_port.source[source_index];
 
-    const auto kTimeOutB = current_millis_ - output_port_[port_index].source_b.millis;
+        if (source.ip == 0) {
+            continue;
+        }
 
-    if (kTimeOutB > (e131::kMergeTimeoutSeconds * 1000U)) {
-        output_port_[port_index].source_b.ip = 0;
-        memset(output_port_[port_index].source_b.cid, 0, e117::kCidLength);
-        output_port_[port_index].is_merging = false;
+        if ((current_millis_ - source.millis) > (e131::kMergeTimeoutSeconds * 1000U)) {
+            ReleaseSource(port_index, source_index);
+            continue;
+        }
+
+        sources_active++;
+    }
+
+    if (sources_active < 2) {
+        output_port.is_merging = false;
     }
 
     auto is_merging = false;
@@ -605,30 +641,68 @@ void E131Bridge::CheckMergeTimeouts(uint32_t port_index) {
     }
 }
 
+/*
+ * The priority has timed out when none of the active sources has sent data within the priority timeout.
+ */
 bool E131Bridge::IsPriorityTimeOut(uint32_t port_index) const {
     assert(port_index < dmxnode::kMaxPorts);
 
-    const auto kTimeOutA = current_millis_ - output_port_[port_index].source_a.millis;
-    const auto kTimeOutB = current_millis_ - output_port_[port_index].source_b.millis;
+    auto is_active = false;
 
-    if ((output_port_[port_index].source_a.ip != 0) && (output_port_[port_index].source_b.ip != 0)) {
-        if ((kTimeOutA < (e131::kPriorityTimeoutSeconds * 1000U)) || (kTimeOutB < (e131::kPriorityTimeoutSeconds * 1000U))) {
-            return false;
-        } else {
-            return true;
+    for (const auto& source : output_port_[port_index].source) {
+        if (source.ip == 0) {
+            continue;
         }
-    } else if ((output_port_[port_index].source_a.ip != 0) && (output_port_[port_index].source_b.ip == 0)) {
-        if (kTimeOutA > (e131::kPriorityTimeoutSeconds * 1000U)) {
-            return true;
+
+        if ((current_millis_ - source.millis) < (e131::kPriorityTimeoutSeconds * 1000U)) {
+            return false;
         }
-    } else if ((output_port_[port_index].source_a.ip == 0) && (output_port_[port_index].source_b.ip != 0)) {
-        if (kTimeOutB > (e131::kPriorityTimeoutSeconds * 1000U)) {
-            return true;
+
+        is_active = true;
+    }
+
+    return is_active;
+}
+
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+/*
+ * A source that stopped sending 0xDD packets falls back to its universe priority.
+ */
+void E131Bridge::CheckSlotPriorityTimeouts(uint32_t port_index) {
+    assert(port_index < dmxnode::kMaxPorts);
+
+    const auto& output_port = output_port_[port_index];
+
+    for (auto sources = output_port.slot_priority_sources; sources != 0; sources &= (sources - 1)) {
+        const auto kSourceIndex = static_cast<uint32_t>(__builtin_ctz(sources));
+
+        if ((current_millis_ - output_port.source[kSourceIndex].slot_priority_millis) > (e131::kPriorityTimeoutSeconds * 1000U)) {
+            ReleaseSlotPriority(port_index, kSourceIndex);
         }
     }
+}
+
+void E131Bridge::ReleaseSlotPriority(uint32_t port_index, uint32_t source_index) {
+    assert(port_index < dmxnode::kMaxPorts);
+    assert(source_index < dmxnode::kMergeSources);
+
+    auto& output_port = output_port_[port_index];
+    const auto kSource = 1U << source_index;
 
-    return false;
+    if ((output_port.slot_priority_sources & kSource) == 0) {
+        return;
+    }
+
+    output_port.slot_priority_sources &= ~kSource;
+    dmxnode::Data::SetSourcePriority(port_index, source_index, output_port.source[source_index].priority);
+
+    // Without any 0xDD source the universe priority arbitration starts over
+    if (output_port.slot_priority_sources == 0) {
+        dmxnode::Data::SetSlotPriority(port_index, false);
+        output_port.priority = e131::priority::kLowest;
+    }
 }
+#endif
 
 bool E131Bridge::IsIpCidMatch(const e131bridge::Source* const kSource) const {
     if (kSource->ip != ip_address_from_) {
@@ -644,135 +718,173 @@ void E131Bridge::HandleDmx() {
     const auto& data = *reinterpret_cast<const e131::DataPacket*>(receive_buffer_);
     const auto* const kDmxData = &data.dmp_layer.property_values[1];
     const auto kDmxSlots = __builtin_bswap16(data.dmp_layer.property_value_count) - 1U;
+    const auto kStartCode = data.dmp_layer.property_values[0];
 
-    for (uint32_t port_index = 0; port_index < dmxnode::kMaxPorts; port_index++) {
-        if (bridge_.port[port_index].direction == dmxnode::Direction::kOutput) {
-            // Frame layer
-            // 8.2 Association of Multicast Addresses and Universe
-            // Note: The identity of the universe shall be determined by the universe number in the
-            // packet and not assumed from the multicast address.
-            if (data.frame_layer.universe != __builtin_bswap16(bridge_.port[port_index].universe)) {
-                continue;
-            }
+    // Alternate start codes which are not supported are ignored
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+    const auto kIsSlotPriority = (kStartCode == e131::startcode::kPerSlotPriority);
 
-            auto& source_a = output_port_[port_index].source_a;
-            auto& source_b = output_port_[port_index].source_b;
+    if ((kStartCode != e131::startcode::kDmx) && !kIsSlotPriority) {
+        return;
+    }
+#else
+    if (kStartCode != e131::startcode::kDmx) {
+        return;
+    }
+#endif
 
-            const auto kIpA = source_a.ip;
-            const auto kIpB = source_b.ip;
+    // Frame layer
+    // 8.2 Association of Multicast Addresses and Universe
+    // Note: The identity of the universe shall be determined by the universe number in the
+    // packet and not assumed from the multicast address.
+    for (auto ports = port_lookup_.Find(__builtin_bswap16(data.frame_layer.universe)); ports != 0; ports &= (ports - 1)) {
+        const auto port_index = dmxnode::PortLookup::PortIndex(ports);
 
-            const auto kIsSourceA = IsIpCidMatch(&source_a);
-            const auto kIsSourceB = IsIpCidMatch(&source_b);
+        auto& output_port = output_port_[port_index];
+        auto source_index = dmxnode::kMergeSources;
 
-            // 6.9.2 Sequence Numbering
-            // Having first received a packet with sequence number A, a second packet with sequence number B
-            // arrives. If, using signed 8-bit binary arithmetic, B – A is less than or equal to 0, but greater than -20 then
-            // the packet containing sequence number B shall be deemed out of sequence and discarded
-            if (kIsSourceA) {
-                const auto kDiff = static_cast<int8_t>(data.frame_layer.sequence_number - source_a.sequence_number_data);
-                source_a.sequence_number_data = data.frame_layer.sequence_number;
-                if ((kDiff <= 0) && (kDiff > -20)) {
-                    continue;
-                }
-            } else if (kIsSourceB) {
-                const auto kDiff = static_cast<int8_t>(data.frame_layer.sequence_number - source_b.sequence_number_data);
-                source_b.sequence_number_data = data.frame_layer.sequence_number;
-                if ((kDiff <= 0) && (kDiff > -20)) {
-                    continue;
-                }
+        for (uint32_t i = 0; i < dmxnode::kMergeSources; i++) {
+            if (IsIpCidMatch(&output_port.source[i])) {
+                source_index = i;
+                break;
             }
+        }
 
-            // This bit, when set to 1, indicates that the data in this packet is intended for use in visualization or media
-            // server preview applications and shall not be used to generate live output.
-            if (e131::OptionsMask::Has(data.frame_layer.options, e131::OptionsMask::Mask::kPreviewData)) {
+        // 6.9.2 Sequence Numbering
+        // Having first received a packet with sequence number A, a second packet with sequence number B
+        // arrives. If, using signed 8-bit binary arithmetic, B – A is less than or equal to 0, but greater than -20 then
+        // the packet containing sequence number B shall be deemed out of sequence and discarded
+        if (source_index != dmxnode::kMergeSources) {
+            auto& source = output_port.source[source_index];
+            const auto kDiff = static_cast<int8_t>(data.frame_layer.sequence_number - source.sequence_number_data);
+            source.sequence_number_data = data.frame_layer.sequence_number;
+            if ((kDiff <= 0) && (kDiff > -20)) {
                 continue;
             }
+        }
 
-            // Upon receipt of a packet containing this bit set to a value of 1, receiver shall enter network data loss condition.
-            // Any property values in these packets shall be ignored.
-            if (e131::OptionsMask::Has(data.frame_layer.options, e131::OptionsMask::Mask::kStreamTerminated)) {
-                if (kIsSourceA || kIsSourceB) {
-                    SetNetworkDataLossCondition(kIsSourceA, kIsSourceB);
-                }
-                continue;
+        // This bit, when set to 1, indicates that the data in this packet is intended for use in visualization or media
+        // server preview applications and shall not be used to generate live output.
+        if (e131::OptionsMask::Has(data.frame_layer.options, e131::OptionsMask::Mask::kPreviewData)) {
+            continue;
+        }
+
+        // Upon receipt of a packet containing this bit set to a value of 1, receiver shall enter network data loss condition.
+        // Any property values in these packets shall be ignored.
+        if (e131::OptionsMask::Has(data.frame_layer.options, e131::OptionsMask::Mask::kStreamTerminated)) {
+            if (source_index != dmxnode::kMergeSources) {
+                SetNetworkDataLossCondition(source_index);
             }
+            continue;
+        }
 
-            if (state_.is_merge_mode) {
-                if (__builtin_expect((!state_.disable_merge_timeout), 1)) {
-                    CheckMergeTimeouts(port_index);
-                }
+        if (state_.is_merge_mode) {
+            if (__builtin_expect((!state_.disable_merge_timeout), 1)) {
+                CheckMergeTimeouts(port_index);
             }
+        }
+
+        auto is_universe_priority = true;
 
-            if (data.frame_layer.priority < state_.priority) {
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+        if (output_port.slot_priority_sources != 0) {
+            CheckSlotPriorityTimeouts(port_index);
+        }
+
+        // With 0xDD sources the priority is arbitrated per slot by the merge
+        is_universe_priority = !kIsSlotPriority && (output_port.slot_priority_sources == 0);
+#endif
+
+        if (is_universe_priority) {
+            if (data.frame_layer.priority < output_port.priority) {
                 if (!IsPriorityTimeOut(port_index)) {
                     continue;
                 }
-                state_.priority = data.frame_layer.priority;
-            } else if (data.frame_layer.priority > state_.priority) {
-                output_port_[port_index].source_a.ip = 0;
-                output_port_[port_index].source_b.ip = 0;
+                output_port.priority = data.frame_layer.priority;
+            } else if (data.frame_layer.priority > output_port.priority) {
+                // The lower priority sources are displaced
+                for (uint32_t i = 0; i < dmxnode::kMergeSources; i++) {
+                    if (output_port.source[i].ip != 0) {
+                        ReleaseSource(port_index, i);
+                    }
+                }
+                output_port.is_merging = false;
                 state_.is_merge_mode = false;
-                state_.priority = data.frame_layer.priority;
+                output_port.priority = data.frame_layer.priority;
             }
+        }
 
-            if ((kIpA == 0) && (kIpB == 0)) {
-                // printf("1. First package from Source\n");
-                source_a.ip = ip_address_from_;
-                source_a.sequence_number_data = data.frame_layer.sequence_number;
-                memcpy(source_a.cid, data.root_layer.cid, 16);
-                source_a.millis = packet_millis_;
-                dmxnode::Data::SetSourceA(port_index, kDmxData, kDmxSlots);
-            } else if (kIsSourceA && (kIpB == 0)) {
-                // printf("2. Continue package from SourceA\n");
-                source_a.sequence_number_data = data.frame_layer.sequence_number;
-                source_a.millis = packet_millis_;
-                dmxnode::Data::SetSourceA(port_index, kDmxData, kDmxSlots);
-            } else if ((kIpA == 0) && kIsSourceB) {
-                // printf("3. Continue package from source_b\n");
-                source_b.sequence_number_data = data.frame_layer.sequence_number;
-                source_b.millis = packet_millis_;
-                dmxnode::Data::SetSourceB(port_index, kDmxData, kDmxSlots);
-            } else if (!kIsSourceA && (kIpB == 0)) {
-                // printf("4. New ip, start merging\n");
-                source_b.ip = ip_address_from_;
-                source_b.sequence_number_data = data.frame_layer.sequence_number;
-                memcpy(source_b.cid, data.root_layer.cid, 16);
-                source_b.millis = packet_millis_;
-                UpdateMergeStatus(port_index);
-                dmxnode::Data::MergeSourceB(port_index, kDmxData, kDmxSlots, output_port_[port_index].merge_mode);
-            } else if ((kIpA == 0) && !kIsSourceB) {
-                // printf("5. New ip, start merging\n");
-                source_a.ip = ip_address_from_;
-                source_a.sequence_number_data = data.frame_layer.sequence_number;
-                memcpy(source_a.cid, data.root_layer.cid, 16);
-                source_a.millis = packet_millis_;
-                UpdateMergeStatus(port_index);
-                dmxnode::Data::MergeSourceA(port_index, kDmxData, kDmxSlots, output_port_[port_index].merge_mode);
-            } else if (kIsSourceA && !kIsSourceB) {
-                // printf("6. Continue merging\n");
-                source_a.sequence_number_data = data.frame_layer.sequence_number;
-                source_a.millis = packet_millis_;
-                UpdateMergeStatus(port_index);
-                dmxnode::Data::MergeSourceA(port_index, kDmxData, kDmxSlots, output_port_[port_index].merge_mode);
-            } else if (!kIsSourceA && kIsSourceB) {
-                // printf("7. Continue merging\n");
-                source_b.sequence_number_data = data.frame_layer.sequence_number;
-                source_b.millis = packet_millis_;
-                UpdateMergeStatus(port_index);
-                dmxnode::Data::MergeSourceB(port_index, kDmxData, kDmxSlots, output_port_[port_index].merge_mode);
+        auto source_free = dmxnode::kMergeSources;
+        uint32_t sources_active = 0;
+
+        for (uint32_t i = 0; i < dmxnode::kMergeSources; i++) {
+            if (output_port.source[i].ip != 0) {
+                sources_active++;
+            } else if (source_free == dmxnode::kMergeSources) {
+                source_free = i;
             }
-#ifndef NDEBUG
-            else if (kIsSourceA && kIsSourceB) {
-                puts("WARN: 8. Source matches both ip, discarding data");
-                return;
-            } else if (!kIsSourceA && !kIsSourceB) {
-                puts("WARN: 9. More than two sources, discarding data");
-                return;
-            } else {
-                puts("ERROR: 0. No cases matched, this shouldn't happen!");
-                return;
+        }
+
+        // The source can be gone by a merge timeout or a higher priority
+        if ((source_index != dmxnode::kMergeSources) && (output_port.source[source_index].ip == 0)) {
+            source_index = dmxnode::kMergeSources;
+        }
+
+        if (source_index == dmxnode::kMergeSources) {
+            if (source_free == dmxnode::kMergeSources) {
+                DEBUG_PUTS("More than kMergeSources sources, discarding data");
+                continue;
+            }
+
+            // The first source starts the sampling period, collecting the other sources and their priorities
+            if ((sources_active == 0) && !output_port.is_transmitting) {
+                output_port.is_sampling = true;
+                output_port.sampling_millis = packet_millis_;
             }
+
+            source_index = source_free;
+            auto& source = output_port.source[source_index];
+            source.ip = ip_address_from_;
+            source.millis = packet_millis_;
+            source.sequence_number_data = data.frame_layer.sequence_number;
+            memcpy(source.cid, data.root_layer.cid, e117::kCidLength);
+            sources_active++;
+        }
+
+        auto& source = output_port.source[source_index];
+        source.priority = data.frame_layer.priority;
+
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+        if (kIsSlotPriority) {
+            // The 0xDD packets do not keep the source alive, the source times out without level data
+            source.slot_priority_millis = packet_millis_;
+            dmxnode::Data::SetSourcePriority(port_index, source_index, kDmxData, kDmxSlots);
+
+            if (output_port.slot_priority_sources == 0) {
+                dmxnode::Data::SetSlotPriority(port_index, true);
+            }
+
+            output_port.slot_priority_sources |= 1U << source_index;
+            continue;
+        }
+
+        // A slot priority of 0 means that the slot is not sourced
+        if ((output_port.slot_priority_sources & (1U << source_index)) == 0) {
+            dmxnode::Data::SetSourcePriority(port_index, source_index, (source.priority != 0) ? source.priority : e131::priority::kLowest);
+        }
 #endif
+
+        source.millis = packet_millis_;
+
+        if (sources_active != 1) {
+            UpdateMergeStatus(port_index);
+        }
+
+        // The sampling period collects the sources and their priorities, nothing is output
+        const auto kIsSampling = output_port.is_sampling && ((packet_millis_ - output_port.sampling_millis) < e131::kSamplingPeriodMillis);
+        output_port.is_sampling = kIsSampling;
+
+        if (!kIsSampling) {
             // This bit indicates whether to lock or revert to an unsynchronized state when synchronization is lost
             // (See Section 11 on Universe Synchronization and 11.1 for discussion on synchronization states).
             // When set to 0, components that had been operating in a synchronized state shall not update with any
@@ -791,12 +903,7 @@ void E131Bridge::HandleDmx() {
                 // Synchronization is required: enter synchronized state (until sync is lost or overridden)
                 if (data.frame_layer.synchronization_address != 0) {
                     if (!state_.is_forced_synchronized) {
-                        // Decide which source triggered the sync request
-                        if (!(kIsSourceA || kIsSourceB)) {
-                            SetSynchronizationAddress((source_a.ip != 0), (source_b.ip != 0), __builtin_bswap16(data.frame_layer.synchronization_address));
-                        } else {
-                            SetSynchronizationAddress(kIsSourceA, kIsSourceB, __builtin_bswap16(data.frame_layer.synchronization_address));
-                        }
+                        SetSynchronizationAddress(source_index, __builtin_bswap16(data.frame_layer.synchronization_address));
                         state_.is_forced_synchronized = true;
                         state_.is_synchronized = true;
                     }
@@ -805,48 +912,65 @@ void E131Bridge::HandleDmx() {
                 // Synchronization not required — allow unsynchronized updates
                 state_.is_forced_synchronized = false;
             }
+        }
 
-            const auto kDoUpdate = ((!state_.is_synchronized) || (state_.disable_synchronize));
+        const auto kDoUpdate = !kIsSampling && ((!state_.is_synchronized) || (state_.disable_synchronize));
+        // Without sync the merge writes straight into the transmit buffer of the output
+        auto* transmit = kDoUpdate ? dmxnode::DataTransmitBuffer(dmxnode_output_type_, port_index) : nullptr;
 
-            if (kDoUpdate) {
-                dmxnode::DataOutput(dmxnode_output_type_, port_index);
+        if (sources_active == 1) {
+            dmxnode::Data::SetSource(port_index, source_index, kDmxData, kDmxSlots, transmit);
+        } else {
+            dmxnode::Data::MergeSource(port_index, source_index, kDmxData, kDmxSlots, output_port.merge_mode, transmit);
+        }
 
-                if (!output_port_[port_index].is_transmitting) {
-                    dmxnode_output_type_->Start(port_index);
-                    output_port_[port_index].is_transmitting = true;
-                    state_.is_changed = true;
-                }
-            } else {
-                dmxnode::DataSet(dmxnode_output_type_, port_index);
-                output_port_[port_index].is_data_pending = true;
-            }
+        if (kIsSampling) {
+            continue;
+        }
 
-            state_.receiving_dmx |= (1U << static_cast<uint8_t>(dmxnode::Direction::kOutput));
+        if (kDoUpdate) {
+            dmxnode::DataOutput(dmxnode_output_type_, port_index, transmit);
+
+            if (!output_port_[port_index].is_transmitting) {
+                dmxnode_output_type_->Start(port_index);
+                output_port_[port_index].is_transmitting = true;
+                state_.is_changed = true;
+            }
+        } else {
+            dmxnode::DataSet(dmxnode_output_type_, port_index);
+            output_port_[port_index].is_data_pending = true;
         }
+
+        state_.receiving_dmx |= (1U << static_cast<uint8_t>(dmxnode::Direction::kOutput));
     }
 }
 
-void E131Bridge::SetNetworkDataLossCondition(bool source_a, bool source_b) {
+void E131Bridge::SetNetworkDataLossCondition(uint32_t source_index) {
     DEBUG_ENTRY();
-    DEBUG_PRINTF("%u %u", static_cast<unsigned>(source_a), static_cast<unsigned>(source_b));
+    DEBUG_PRINTF("%u", static_cast<unsigned>(source_index));
 
     state_.is_changed = true;
     auto do_failsafe = false;
 
-    if (source_a && source_b) {
+    if (source_index == dmxnode::kMergeSources) {
         state_.is_network_data_loss = true;
         state_.is_merge_mode = false;
         state_.is_synchronized = false;
         state_.is_forced_synchronized = false;
-        state_.priority = e131::priority::kLowest;
 
         for (uint32_t i = 0; i < dmxnode::kMaxPorts; i++) {
+            output_port_[i].priority = e131::priority::kLowest;
+            output_port_[i].is_sampling = false;
+#if defined(CONFIG_DMXNODE_SLOT_PRIORITY)
+            output_port_[i].slot_priority_sources = 0;
+            dmxnode::Data::SetSlotPriority(i, false);
+#endif
             if (output_port_[i].is_transmitting) {
                 do_failsafe = true;
-                output_port_[i].source_a.ip = 0;
-                memset(output_port_[i].source_a.cid, 0, e117::kCidLength);
-                output_port_[i].source_b.ip = 0;
-                memset(output_port_[i].source_b.cid, 0, e117::kCidLength);
+                for (auto& source : output_port_[i].source) {
+                    source.ip = 0;
+                    memset(source.cid, 0, e117::kCidLength);
+                }
                 dmxnode::Data::ClearLength(i);
                 output_port_[i].is_transmitting = false;
                 output_port_[i].is_merging = false;
@@ -855,15 +979,8 @@ void E131Bridge::SetNetworkDataLossCondition(bool source_a, bool source_b) {
     } else {
         for (uint32_t i = 0; i < dmxnode::kMaxPorts; i++) {
             if (output_port_[i].is_transmitting) {
-                if ((source_a) && (output_port_[i].source_a.ip != 0)) {
-                    output_port_[i].source_a.ip = 0;
-                    memset(output_port_[i].source_a.cid, 0, e117::kCidLength);
-                    output_port_[i].is_merging = false;
-                }
-
-                if ((source_b) && (output_port_[i].source_b.ip != 0)) {
-                    output_port_[i].source_b.ip = 0;
-                    memset(output_port_[i].source_b.cid, 0, e117::kCidLength);
+                if (output_port_[i].source[source_index].ip != 0) {
+                    ReleaseSource(i, source_index);
                     output_port_[i].is_merging = false;
                 }
 
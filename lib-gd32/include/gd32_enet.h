@@ -200,20 +200,28 @@ inline void ClearDmaTxFlagsAndResume() {
  *
  * @note This function ensures that the DMA reception process continues without interruptions
  * caused by the Rx buffer unavailable condition.
+ *
+ * @return true when the Rx descriptor ring was full and reception has been resumed.
  */
 #if defined(GD32H7XX)
-inline void HandleRxBufferUnavailable() {
+inline bool HandleRxBufferUnavailable() {
     if (0 != (ENET_DMA_STAT(ENETx) & ENET_DMA_STAT_RBU)) {
         ENET_DMA_STAT(ENETx) = ENET_DMA_STAT_RBU; ///< Clear RBU flag
         ENET_DMA_RPEN(ENETx) = 0;                 ///< Resume DMA reception
+        return true;
     }
+
+    return false;
 }
 #else
-inline void HandleRxBufferUnavailable() {
+inline bool HandleRxBufferUnavailable() {
     if (0 != (ENET_DMA_STAT & ENET_DMA_STAT_RBU)) {
         ENET_DMA_STAT = ENET_DMA_STAT_RBU; ///< Clear RBU flag
         ENET_DMA_RPEN = 0;                 ///< Resume DMA reception
+        return true;
     }
+
+    return false;
 }
 #endif
 
@@ -30,11 +30,26 @@
 #include "core/protocol/arp.h"
 
 namespace network::arp {
-enum class Flags { kFlagInsert, kFlagUpdate };
+enum class Flags { kFlagInsert, kFlagUpdate, kFlagLearn };
+
+struct Counters {
+    uint32_t hit;       ///< Sends with a resolved next hop
+    uint32_t miss;      ///< Sends waiting on resolution
+    uint32_t queued;    ///< Packets queued while waiting
+    uint32_t dropped;   ///< Packets dropped: queue full, no memory or no reply
+    uint32_t refresh;   ///< Requests sent to refresh a record before it expires
+    uint32_t learned;   ///< Records added from a gratuitous ARP
+    uint32_t stall_max; ///< Milliseconds, longest time a packet was queued
+};
+
+namespace globals {
+extern struct Counters counter;
+} // namespace globals
 
 void Init();
 void Input(const struct network::arp::Header*);
 void Send(void*, const uint32_t, uint32_t);
+void SendFragment(void*, uint32_t, uint32_t);
 #if defined CONFIG_NET_ENABLE_PTP
 void SendTimestamp(void*, uint32_t, uint32_t);
 #endif
@@ -0,0 +1,48 @@
+/**
+ * @file fragment.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef CORE_IP4_FRAGMENT_H_
+#define CORE_IP4_FRAGMENT_H_
+
+#include <cstdint>
+
+namespace network::ip4::fragment {
+struct Counters {
+    uint32_t received;    ///< Fragments received
+    uint32_t reassembled; ///< Datagrams reassembled and delivered
+    uint32_t timeout;     ///< Datagrams discarded, not complete in time
+    uint32_t dropped;     ///< Fragments dropped: unsupported, too large, no buffer
+    uint32_t busy;        ///< Of the dropped, those of a datagram while another one is reassembled
+    uint32_t sent;        ///< Fragments sent
+    uint32_t latency_max; ///< Milliseconds from the first to the last fragment
+    uint32_t memory_max;  ///< Bytes in use for reassembly, high-water mark
+};
+
+namespace globals {
+extern struct Counters counter;
+} // namespace globals
+} // namespace network::ip4::fragment
+
+#endif // CORE_IP4_FRAGMENT_H_
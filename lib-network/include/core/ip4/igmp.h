@@ -35,4 +35,17 @@ void SetHash(const uint8_t*);
 void ResetHash();
 } // namespace emac::multicast
 
+namespace network::igmp {
+struct Counters {
+    uint32_t accepted;       ///< Multicast frames for a joined group
+    uint32_t rejected_hash;  ///< Passed the EMAC hash filter, MAC address not joined
+    uint32_t rejected_alias; ///< MAC address joined, for a group with the same MAC address
+    uint32_t probes_max;     ///< Longest probe sequence in the group table
+};
+
+namespace globals {
+extern struct Counters counter;
+} // namespace globals
+} // namespace network::igmp
+
 #endif // CORE_IP4_IGMP_H_
@@ -40,6 +40,7 @@ struct Flags {
     static constexpr uint16_t kFlagLf = 0x0000;
     static constexpr uint16_t kFlagMf = 0x2000;
     static constexpr uint16_t kFlagDf = 0x4000;
+    static constexpr uint16_t kOffsetMask = 0x1FFF; ///< Fragment offset in units of 8 bytes
 };
 
 struct Proto {
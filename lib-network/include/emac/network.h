@@ -47,6 +47,17 @@
 
 uint32_t emac::eth::Recv(uint8_t**);
 
+/**
+ * Maximum number of received frames handled in one network::Run() pass.
+ * The remaining frames stay in the Rx descriptor ring for the next pass,
+ * so that a burst does not starve the output stages of the superloop.
+ */
+#if !defined(CONFIG_NET_RX_BUDGET)
+#define CONFIG_NET_RX_BUDGET 16
+#endif
+
+static_assert(CONFIG_NET_RX_BUDGET > 0);
+
 namespace network {
 namespace global {
 extern emac::phy::Link link_state;
@@ -64,10 +75,16 @@ inline void Run() {
     auto length = emac::eth::Recv(&ethernet_buffer);
 
     if (__builtin_expect((length > 0), 0)) {
+        uint32_t batch = 0;
         do {
             network::iface::EthernetInput(ethernet_buffer, length);
+            if (++batch == CONFIG_NET_RX_BUDGET) {
+                break;
+            }
             length = emac::eth::Recv(&ethernet_buffer);
         } while (length > 0);
+
+        emac::eth::RecvBatch(batch);
     }
 #if defined(ENABLE_HTTPD)
     network::tcp::Run();
@@ -101,6 +101,27 @@ struct Counters {
     struct Transmit {
         uint32_t ok = 0, err = 0, drp = 0, ovr = 0;
     } tx;
+    struct ReceiveQueue {
+        uint32_t ovr = 0, hwm = 0, batch = 0, batch_max = 0;
+    } rxq;
+    struct TransmitQueue {
+        uint32_t hwm = 0, busy_cycles = 0, busy_max = 0;
+    } txq;
+    struct Fragment {
+        uint32_t rx = 0, tx = 0, ok = 0, tmo = 0, drp = 0, busy = 0, latency_max = 0, mem_hwm = 0;
+    } frag;
+    struct Multicast {
+        uint32_t ok = 0, drp_hash = 0, drp_alias = 0, probe_max = 0;
+    } mc;
+    struct Arp {
+        uint32_t hit = 0, miss = 0, queued = 0, drp = 0, refresh = 0, learned = 0, stall_max = 0;
+    } arp;
+    struct Memory {
+        uint32_t hwm = 0, fail = 0, small_hwm = 0, small_fail = 0;
+    } mem;
+    struct Tcp {
+        uint32_t rtx = 0, fast_rtx = 0, dupack = 0, srtt_max = 0;
+    } tcp;
 };
 
 void GetCounters(Counters& counters);
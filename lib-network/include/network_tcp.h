@@ -50,9 +50,24 @@ using CallbackConnect = void (*)(ConnHandle, Event, void*);
 ConnHandle Connect(uint32_t remote_ip, uint16_t remote_port, CallbackConnect cb_connect, CallbackData cb_data, void* context);
 
 // Common
+// Returns 0 when sent, 1 when (partly) queued, -1 for an invalid connection
+// and -2 when nothing is accepted. Data that does not fit in network memory is
+// sent from the caller's buffer, which must then stay valid until the connection
+// is closed; while that is pending, Send() returns -2.
 int32_t Send(ConnHandle conn_handle, const uint8_t* buffer, uint32_t length);
 int32_t Close(ConnHandle conn_handle); // graceful FIN
 void Abort(ConnHandle conn_handle);    // RST
+
+struct Counters {
+    uint32_t retransmit;      ///< Segments retransmitted on timeout
+    uint32_t fast_retransmit; ///< Segments retransmitted after duplicate ACKs
+    uint32_t duplicate_ack;   ///< Duplicate ACKs received
+    uint32_t srtt_max;        ///< Smoothed round-trip time in ms, high-water mark
+};
+
+namespace globals {
+extern struct Counters counter;
+} // namespace globals
 } // namespace network::tcp
 
 #endif // NETWORK_TCP_H_
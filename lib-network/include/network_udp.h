@@ -29,6 +29,16 @@
 #include <cstdint>
 
 namespace network::udp {
+/**
+ * The callback borrows the payload from the EMAC receive buffer.
+ * The buffer is released when the callback returns, so it must not be
+ * referenced afterwards. Data that needs to survive must be copied.
+ * The buffer may be modified in place up to udp::kDataSize bytes.
+ *
+ * A datagram reassembled from IPv4 fragments is passed at its full length,
+ * which can exceed udp::kDataSize, the maximum of a single frame. Its
+ * buffer is released when the callback returns as well.
+ */
 typedef void (*UdpCallbackFunctionPtr)(const uint8_t*, uint32_t, uint32_t, uint16_t);
 
 int32_t Begin(uint16_t, UdpCallbackFunctionPtr callback);
@@ -36,6 +46,15 @@ int32_t End(uint16_t);
 uint32_t Recv(const int32_t, const uint8_t**, uint32_t*, uint16_t*);
 void Send(int32_t, const uint8_t*, uint32_t, uint32_t, uint16_t);
 void SendWithTimestamp(int32_t, const uint8_t*, uint32_t, uint32_t, uint16_t);
+
+/**
+ * Zero-copy transmit: the payload is written straight into the EMAC transmit
+ * buffer, behind the Ethernet, IPv4 and UDP headers, and is then sent with SendBuffer().
+ * Nothing else may be sent between GetSendBuffer() and SendBuffer().
+ * The buffer holds at most udp::kDataSize bytes.
+ */
+uint8_t* GetSendBuffer();
+void SendBuffer(int32_t, uint32_t, uint32_t, uint16_t);
 } // namespace network::udp
 
 #endif // NETWORK_UDP_H_
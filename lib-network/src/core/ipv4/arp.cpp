@@ -47,6 +47,7 @@
 #include "core/protocol/ethernet.h"
 #include "core/protocol/arp.h"
 #include "softwaretimers.h" // IWYU pragma: keep
+#include "timing.h"
 #include "../src/core/network_memory.h"
 #include "firmware/debug/debug_debug.h"
 #include "firmware/debug/debug_dump.h"
@@ -77,6 +78,12 @@ static constexpr auto kMaxRecords = 16;
 static constexpr auto kMaxRecords = ARP_MAX_RECORDS;
 #endif
 
+#if !defined ARP_MAX_PENDING
+static constexpr auto kMaxPending = 4;
+#else
+static constexpr auto kMaxPending = ARP_MAX_PENDING;
+#endif
+
 namespace network::globals {
 extern uint32_t on_network_mask;
 } // namespace network::globals
@@ -86,6 +93,8 @@ static constexpr uint32_t kTimerInterval = 1000;     ///< 1 second
 static constexpr uint32_t kMaxProbing = 2;           ///< 2 * 1 second
 static constexpr uint32_t kMaxReachable = (10 * 60); ///< (10 * 60) * 1 second = 10 minutes
 static constexpr uint32_t kMaxStale = (5 * 60);      ///< ( 5 * 60) * 1 second =  5 minutes
+static constexpr uint32_t kRefreshLead = 30;         ///< A reachable record is refreshed in its last 30 seconds
+static constexpr uint32_t kRefreshInterval = 10;     ///< with a unicast request every 10 seconds
 
 enum class State {
     kStateEmpty,
@@ -94,26 +103,53 @@ enum class State {
     kStateStale,
 };
 
-struct Packet {
-    uint8_t* p;
-    uint32_t size;
-#if defined CONFIG_NET_ENABLE_PTP
-    bool isTimestamp;
-#endif
-};
-
 struct Record {
     uint32_t ip;
-    Packet packet;
     uint8_t mac_address[network::ethernet::kAddressLength];
     uint16_t age;
     State state;
 };
 
+/*
+ * Packets waiting on the resolution of their next hop. The packet is copied
+ * into network::memory, so the sender never waits. They are sent in order of
+ * arrival as soon as the reply is received, and dropped when the probe times out.
+ */
+struct Pending {
+    uint8_t* p;
+    uint32_t ip;
+    uint32_t millis;
+    uint32_t sequence; ///< Order of arrival
+    uint16_t size;
+    uint8_t blocks;
+#if defined CONFIG_NET_ENABLE_PTP
+    bool isTimestamp;
+#endif
+};
+
+/*
+ * Open addressing hash table (linear probing) ip -> index in s_arp_records.
+ * Only a miss, when a record has to be claimed, scans the records.
+ */
+static constexpr uint32_t kHashBits = (32U - static_cast<uint32_t>(__builtin_clz(kMaxRecords))) + 1U;
+static constexpr uint32_t kHashSize = 1U << kHashBits;
+static constexpr uint32_t kHashMask = kHashSize - 1U;
+static constexpr uint8_t kHashEmpty = 0xFF;
+
+static_assert(kHashSize >= (2 * kMaxRecords));
+static_assert(kMaxRecords < kHashEmpty);
+
 static network::arp::Record s_arp_records[kMaxRecords] SECTION_NETWORK ALIGNED;
+static uint8_t s_arp_hash[kHashSize] SECTION_NETWORK ALIGNED;
+static network::arp::Pending s_pending[kMaxPending] SECTION_NETWORK ALIGNED;
+static uint32_t s_pending_sequence;
 static struct network::arp::Header s_arp_request SECTION_NETWORK ALIGNED;
 static struct network::arp::Header s_arp_reply SECTION_NETWORK ALIGNED;
 
+namespace globals {
+struct Counters counter;
+} // namespace globals
+
 #ifndef NDEBUG
 static constexpr char kStates[4][12] = {
     "EMPTY",
@@ -123,7 +159,7 @@ static constexpr char kStates[4][12] = {
 };
 
 void static CacheRecordDump(network::arp::Record* record) {
-    printf("%p %-4d %c " MACSTR " %-10s " IPSTR "\n", record, record->age, record->packet.p == nullptr ? '-' : 'Q', MAC2STR(record->mac_address), kStates[static_cast<unsigned>(record->state)], IP2STR(record->ip));
+    printf("%p %-4d " MACSTR " %-10s " IPSTR "\n", record, record->age, MAC2STR(record->mac_address), kStates[static_cast<unsigned>(record->state)], IP2STR(record->ip));
 }
 
 void static CacheDump() {
@@ -141,32 +177,111 @@ void static CacheRecordDump([[maybe_unused]] network::arp::Record* record) {}
 void static CacheDump() {}
 #endif
 
-static network::arp::Record* FindRecord(uint32_t destination_ip, [[maybe_unused]] arp::Flags flag) {
+static constexpr uint32_t Hash(uint32_t ip) {
+    return (ip * 0x9E3779B1U) >> (32U - kHashBits);
+}
+
+static int32_t Find(uint32_t ip, uint32_t& slot) {
+    slot = Hash(ip);
+
+    while (s_arp_hash[slot] != kHashEmpty) {
+        const auto kIndex = s_arp_hash[slot];
+
+        if (s_arp_records[kIndex].ip == ip) {
+            return kIndex;
+        }
+
+        slot = (slot + 1) & kHashMask;
+    }
+
+    return -1;
+}
+
+// Backward shift deletion, no tombstones are needed.
+static void HashRemove(uint32_t slot) {
+    auto hole = slot;
+    auto next = (slot + 1) & kHashMask;
+
+    while (s_arp_hash[next] != kHashEmpty) {
+        const auto kHome = Hash(s_arp_records[s_arp_hash[next]].ip);
+
+        if (((next - kHome) & kHashMask) >= ((next - hole) & kHashMask)) {
+            s_arp_hash[hole] = s_arp_hash[next];
+            hole = next;
+        }
+
+        next = (next + 1) & kHashMask;
+    }
+
+    s_arp_hash[hole] = kHashEmpty;
+}
+
+static void PendingFree(network::arp::Pending& pending) {
+    if (pending.blocks == 1) {
+        network::memory::Allocator::Instance().Free(pending.p);
+    } else {
+        network::memory::Allocator::Instance().FreeContiguous(pending.p, pending.blocks);
+    }
+    pending.p = nullptr;
+}
+
+static void PendingDrop(uint32_t ip) {
+    for (auto& pending : s_pending) {
+        if ((pending.p != nullptr) && (pending.ip == ip)) {
+            PendingFree(pending);
+            globals::counter.dropped++;
+        }
+    }
+}
+
+static void CacheCleanRecord(network::arp::Record& record) {
+    uint32_t slot;
+    const auto kIndex = Find(record.ip, slot);
+
+    if ((kIndex >= 0) && (&s_arp_records[kIndex] == &record)) {
+        HashRemove(slot);
+    }
+
+    PendingDrop(record.ip);
+
+    std::memset(&record, 0, sizeof(struct network::arp::Record));
+}
+
+/*
+ * With kFlagInsert an empty record is claimed, else the oldest stale one,
+ * else the oldest reachable one. Records being probed are never evicted.
+ * With kFlagLearn only an empty record is claimed.
+ */
+static network::arp::Record* FindRecord(uint32_t destination_ip, arp::Flags flag) {
     ARP_DEBUG_ENTRY();
 
+    uint32_t slot;
+    const auto kIndex = Find(destination_ip, slot);
+
+    if (kIndex >= 0) {
+        ARP_DEBUG_EXIT();
+        return &s_arp_records[kIndex];
+    }
+
+    if (flag == arp::Flags::kFlagUpdate) {
+        ARP_DEBUG_EXIT();
+        return nullptr;
+    }
+
+    network::arp::Record* empty = nullptr;
     network::arp::Record* stale = nullptr;
     network::arp::Record* reachable = nullptr;
     uint32_t age_stale = 0;
     uint32_t age_reachable = 0;
 
     for (auto& record : s_arp_records) {
-        if (record.ip == destination_ip) {
-            ARP_DEBUG_EXIT();
-            return &record;
-        }
-
-        if (flag == arp::Flags::kFlagUpdate) {
-            continue;
-        }
-
         if (record.state == network::arp::State::kStateEmpty) {
-            record.ip = destination_ip;
-            ARP_DEBUG_EXIT();
-            return &record;
+            empty = &record;
+            break;
         }
 
         if (record.state == network::arp::State::kStateReachable) {
-            if (record.age > age_reachable) {
+            if (record.age >= age_reachable) {
                 age_reachable = record.age;
                 reachable = &record;
             }
@@ -174,7 +289,7 @@ static network::arp::Record* FindRecord(uint32_t destination_ip, [[maybe_unused]
         }
 
         if (record.state == network::arp::State::kStateStale) {
-            if (record.age > age_stale) {
+            if (record.age >= age_stale) {
                 age_stale = record.age;
                 stale = &record;
             }
@@ -182,18 +297,73 @@ static network::arp::Record* FindRecord(uint32_t destination_ip, [[maybe_unused]
         }
     }
 
-    if (stale != nullptr) {
+    auto* record = (empty != nullptr) ? empty : ((flag == arp::Flags::kFlagLearn) ? nullptr : ((stale != nullptr) ? stale : reachable));
+
+    if (record == nullptr) {
         ARP_DEBUG_EXIT();
-        return stale;
+        return nullptr;
     }
 
-    if (reachable != nullptr) {
-        ARP_DEBUG_EXIT();
-        return reachable;
+    if (record != empty) {
+        CacheCleanRecord(*record);
+        // The eviction may have shifted the probe sequence
+        Find(destination_ip, slot);
     }
 
+    record->ip = destination_ip;
+    s_arp_hash[slot] = static_cast<uint8_t>(record - s_arp_records);
+
     ARP_DEBUG_EXIT();
-    return nullptr;
+    return record;
+}
+
+/*
+ * The slots are reused in any order, so the oldest packet for the
+ * record is looked up each time by its sequence number.
+ */
+static void PendingSend(const network::arp::Record& record) {
+    for (;;) {
+        network::arp::Pending* oldest = nullptr;
+
+        for (auto& pending : s_pending) {
+            if ((pending.p == nullptr) || (pending.ip != record.ip)) {
+                continue;
+            }
+
+            if ((oldest == nullptr) || (static_cast<int32_t>(pending.sequence - oldest->sequence) < 0)) {
+                oldest = &pending;
+            }
+        }
+
+        if (oldest == nullptr) {
+            return;
+        }
+
+        auto& pending = *oldest;
+        auto* udp = reinterpret_cast<struct network::udp::Header*>(pending.p);
+        std::memcpy(udp->ether.dst, record.mac_address, network::ethernet::kAddressLength);
+        udp->ip4.chksum = 0;
+#if !defined(CHECKSUM_BY_HARDWARE)
+        udp->ip4.chksum = Chksum(reinterpret_cast<void*>(&udp->ip4), sizeof(udp->ip4));
+#endif
+#if defined CONFIG_NET_ENABLE_PTP
+        if (!pending.isTimestamp) {
+#endif
+            debug::Dump(pending.p, pending.size);
+            emac::eth::Send(pending.p, pending.size);
+#if defined CONFIG_NET_ENABLE_PTP
+        } else {
+            emac::eth::SendTimestamp(pending.p, pending.size);
+        }
+#endif
+        const auto kStall = timing::Millis() - pending.millis;
+
+        if (kStall > globals::counter.stall_max) {
+            globals::counter.stall_max = kStall;
+        }
+
+        PendingFree(pending);
+    }
 }
 
 static void CacheUpdate(const uint8_t* mac_address, uint32_t ip, arp::Flags flag) {
@@ -203,36 +373,25 @@ static void CacheUpdate(const uint8_t* mac_address, uint32_t ip, arp::Flags flag
     auto* record = FindRecord(ip, flag);
 
     if (record == nullptr) {
-        assert(flag == arp::Flags::kFlagUpdate);
+        assert(flag != arp::Flags::kFlagInsert);
         ARP_DEBUG_EXIT();
         return;
     }
 
+    if ((flag == arp::Flags::kFlagLearn) && (record->state == network::arp::State::kStateEmpty)) {
+        globals::counter.learned++;
+    }
+
+    const auto kWasProbe = (record->state == network::arp::State::kStateProbe);
+
     record->state = network::arp::State::kStateReachable;
     record->age = 0;
     std::memcpy(record->mac_address, mac_address, network::ethernet::kAddressLength);
 
     CacheRecordDump(record);
 
-    if (record->packet.p != nullptr) {
-        auto* udp = reinterpret_cast<struct network::udp::Header*>(record->packet.p);
-        std::memcpy(udp->ether.dst, record->mac_address, network::ethernet::kAddressLength);
-        udp->ip4.chksum = 0;
-#if !defined(CHECKSUM_BY_HARDWARE)
-        udp->ip4.chksum = Chksum(reinterpret_cast<void*>(&udp->ip4), sizeof(udp->ip4));
-#endif
-#if defined CONFIG_NET_ENABLE_PTP
-        if (!record->packet.isTimestamp) {
-#endif
-            debug::Dump(record->packet.p, record->packet.size);
-            emac::eth::Send(record->packet.p, record->packet.size);
-#if defined CONFIG_NET_ENABLE_PTP
-        } else {
-            emac::eth::SendTimestamp(record->packet.p, record->packet.size);
-        }
-#endif
-        network::memory::Allocator::Instance().Free(record->packet.p);
-        record->packet.p = nullptr;
+    if (kWasProbe) {
+        PendingSend(*record);
     }
 
     ARP_DEBUG_EXIT();
@@ -246,44 +405,64 @@ static void SendRequest(uint32_t ip) {
     emac::eth::Send(reinterpret_cast<void*>(&s_arp_request), sizeof(struct network::arp::Header));
 }
 
-template <network::arp::EthSend S> static void Query(uint32_t destination_ip, void* packet, uint32_t size, [[maybe_unused]] arp::Flags flag) {
-    ARP_DEBUG_ENTRY();
-    ARP_DEBUG_PRINTF(IPSTR " %c", IP2STR(destination_ip), flag == arp::Flags::kFlagUpdate ? 'U' : 'I');
+static void PendingQueue(uint32_t destination_ip, const void* packet, uint32_t size, [[maybe_unused]] bool is_timestamp) {
+    for (auto& pending : s_pending) {
+        if (pending.p != nullptr) {
+            continue;
+        }
 
-    auto* record_found = FindRecord(destination_ip, flag);
-    assert(record_found != nullptr);
+        const auto kBlocks = (size + network::memory::kBlockSize - 1) / network::memory::kBlockSize;
 
-    CacheRecordDump(record_found);
+        // A short frame can take a small block
+        auto& allocator = network::memory::Allocator::Instance();
+        pending.p = (kBlocks == 1) ? allocator.Allocate(size) : allocator.AllocateContiguous(kBlocks);
 
-    if (record_found->state == network::arp::State::kStateEmpty) {
-        if (record_found->packet.p != nullptr) {
-            network::memory::Allocator::Instance().Free(record_found->packet.p);
+        if (pending.p == nullptr) {
+            break;
         }
 
-        printf("size=%u\n", static_cast<unsigned>(size));
-        assert(size <= network::memory::kBlockSize);
-        record_found->packet.p = network::memory::Allocator::Instance().Allocate();
-        assert(record_found->packet.p != nullptr);
-
-        std::memcpy(record_found->packet.p, packet, size);
-        record_found->packet.size = size;
+        std::memcpy(pending.p, packet, size);
+        pending.ip = destination_ip;
+        pending.millis = timing::Millis();
+        pending.sequence = s_pending_sequence++;
+        pending.size = static_cast<uint16_t>(size);
+        pending.blocks = static_cast<uint8_t>(kBlocks);
 #if defined CONFIG_NET_ENABLE_PTP
-        record_found->packet.isTimestamp = (S != network::arp::EthSend::kIsNormal);
+        pending.isTimestamp = is_timestamp;
 #endif
-        record_found->state = network::arp::State::kStateProbe;
-        record_found->age = 0;
-        SendRequest(destination_ip);
+        globals::counter.queued++;
+        return;
     }
 
-    ARP_DEBUG_EXIT();
+    globals::counter.dropped++;
 }
 
-static void CacheCleanRecord(network::arp::Record& record) {
-    if (record.packet.p != nullptr) {
-        network::memory::Allocator::Instance().Free(record.packet.p);
+template <network::arp::EthSend S> static void Query(uint32_t destination_ip, void* packet, uint32_t size) {
+    ARP_DEBUG_ENTRY();
+    ARP_DEBUG_PRINTF(IPSTR, IP2STR(destination_ip));
+
+    auto* record_found = FindRecord(destination_ip, arp::Flags::kFlagInsert);
+
+    if (record_found == nullptr) {
+        // All records are being probed
+        globals::counter.dropped++;
+        ARP_DEBUG_EXIT();
+        return;
     }
 
-    std::memset(&record, 0, sizeof(struct network::arp::Record));
+    CacheRecordDump(record_found);
+
+    if constexpr (S != network::arp::EthSend::kIsFragment) {
+        PendingQueue(destination_ip, packet, size, S != network::arp::EthSend::kIsNormal);
+    }
+
+    if (record_found->state == network::arp::State::kStateEmpty) {
+        record_found->state = network::arp::State::kStateProbe;
+        record_found->age = 0;
+        SendRequest(destination_ip);
+    }
+
+    ARP_DEBUG_EXIT();
 }
 
 static void SendRequestUnicast(uint32_t ip, const uint8_t* mac_address) {
@@ -314,12 +493,17 @@ static void Timer([[maybe_unused]] TimerHandle_t handle) {
                     if (record.age > network::arp::kMaxReachable) {
                         record.state = network::arp::State::kStateStale;
                         record.age = 0;
+                    } else if ((record.age >= (network::arp::kMaxReachable - network::arp::kRefreshLead)) && (((network::arp::kMaxReachable - record.age) % network::arp::kRefreshInterval) == 0)) {
+                        // Refresh while the record is still in use, the reply resets the age
+                        globals::counter.refresh++;
+                        SendRequestUnicast(record.ip, record.mac_address);
                     }
                     break;
 
                 case network::arp::State::kStateStale:
                     if (record.age > network::arp::kMaxStale) {
                         record.state = network::arp::State::kStateProbe;
+                        record.age = 0;
                         SendRequestUnicast(record.ip, record.mac_address);
                     }
                     break;
@@ -358,6 +542,12 @@ void __attribute__((cold)) Init() {
         std::memset(&record, 0, sizeof(struct network::arp::Record));
     }
 
+    std::memset(s_arp_hash, kHashEmpty, sizeof(s_arp_hash));
+
+    for (auto& pending : s_pending) {
+        pending.p = nullptr;
+    }
+
     // ARP Request template
     // Ethernet header
     std::memcpy(s_arp_request.ether.src, netif::global::netif_default.hwaddr, network::ethernet::kAddressLength);
@@ -417,7 +607,11 @@ __attribute__((hot)) void Input(const struct network::arp::Header* arp) {
     //     can result in directly sending the queued packets for this host.
     // ARP message not directed to us?
     // ->  update the source IP address in the cache, if present
-    CacheUpdate(arp->arp.sender_mac, network::MemcpyIp(arp->arp.sender_ip), kToUs ? arp::Flags::kFlagInsert : arp::Flags::kFlagUpdate);
+    // Gratuitous ARP (RFC 5227) is learned when there is an empty record.
+    const auto kSenderIp = network::MemcpyIp(arp->arp.sender_ip);
+    const auto kIsGratuitous = (kSenderIp == kIpTarget) && (kSenderIp != 0);
+
+    CacheUpdate(arp->arp.sender_mac, kSenderIp, kToUs ? arp::Flags::kFlagInsert : (kIsGratuitous ? arp::Flags::kFlagLearn : arp::Flags::kFlagUpdate));
 
     switch (arp->arp.opcode) {
         case __builtin_bswap16(network::arp::OpCode::kRqstRqst):
@@ -469,26 +663,44 @@ template <network::arp::EthSend S> static void SendImplementation(void* packet,
         }
     }
 
-    for (auto& record : s_arp_records) {
-        if (record.state >= network::arp::State::kStateReachable) {
-            if (record.ip == destination_ip) {
-                std::memcpy(p->ether.dst, record.mac_address, network::ethernet::kAddressLength);
+    uint32_t slot;
+    const auto kIndex = Find(destination_ip, slot);
+
+    if (__builtin_expect(((kIndex >= 0) && (s_arp_records[kIndex].state >= network::arp::State::kStateReachable)), 1)) {
+        globals::counter.hit++;
+
+        std::memcpy(p->ether.dst, s_arp_records[kIndex].mac_address, network::ethernet::kAddressLength);
 
-                if constexpr (S == network::arp::EthSend::kIsNormal) {
-                    emac::eth::Send(packet, size);
-                }
+        // UDP builds the frame in the DMA buffer, there is nothing to copy
+        const auto kIsDmaBuffer = emac::eth::IsSendDmaBuffer(packet);
+
+        if constexpr (S == network::arp::EthSend::kIsNormal) {
+            if (kIsDmaBuffer) {
+                emac::eth::Send(size);
+            } else {
+                emac::eth::Send(packet, size);
+            }
+        } else if constexpr (S == network::arp::EthSend::kIsFragment) {
+            assert(kIsDmaBuffer);
+            emac::eth::SendFragment(size);
+        }
 #if defined CONFIG_NET_ENABLE_PTP
-                else if constexpr (S == network::arp::EthSend::kIsTimestamp) {
-                    emac::eth::SendTimestamp(packet, size);
-                }
-#endif
-                ARP_DEBUG_EXIT();
-                return;
+        else if constexpr (S == network::arp::EthSend::kIsTimestamp) {
+            if (kIsDmaBuffer) {
+                emac::eth::SendTimestamp(size);
+            } else {
+                emac::eth::SendTimestamp(packet, size);
             }
         }
+#endif
+        ARP_DEBUG_EXIT();
+        return;
     }
 
-    Query<S>(destination_ip, packet, size, arp::Flags::kFlagInsert);
+    globals::counter.miss++;
+
+    // A fragment is not queued, the datagram is lost anyway when one of its fragments is dropped
+    Query<S>(destination_ip, packet, size);
 
     ARP_DEBUG_EXIT();
 }
@@ -497,6 +709,10 @@ void Send(void* packet, uint32_t size, uint32_t remote_ip) {
     SendImplementation<network::arp::EthSend::kIsNormal>(packet, size, remote_ip);
 }
 
+void SendFragment(void* packet, uint32_t size, uint32_t remote_ip) {
+    SendImplementation<network::arp::EthSend::kIsFragment>(packet, size, remote_ip);
+}
+
 #if defined CONFIG_NET_ENABLE_PTP
 void SendTimestamp(void* packet, uint32_t size, uint32_t remote_ip) {
     SendImplementation<network::arp::EthSend::kIsTimestamp>(packet, size, remote_ip);
@@ -0,0 +1,321 @@
+/**
+ * @file fragment.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * https://www.rfc-editor.org/rfc/rfc791
+ * Internet Protocol, Fragmentation and Reassembly
+ */
+
+#if !defined(CONFIG_REMOTECONFIG_MINIMUM)
+#pragma GCC push_options
+#pragma GCC optimize("O2")
+#pragma GCC optimize("no-tree-loop-distribute-patterns")
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
+#include "../src/core/network_memcpy.h"
+#include "../src/core/network_private.h"
+#include "../src/core/network_memory.h"
+#include "core/ip4/fragment.h"
+#include "ip4/ip4_address.h"
+#include "core/protocol/ip4.h"
+#include "core/protocol/udp.h"
+#include "softwaretimers.h" // IWYU pragma: keep
+#include "timing.h"
+#include "firmware/debug/debug_debug.h"
+
+#if defined(DEBUG_NETWORK_FRAGMENT)
+#define FRAGMENT_DEBUG_PRINTF(...) DEBUG_PRINTF(__VA_ARGS__)
+#else
+#define FRAGMENT_DEBUG_PRINTF(...) \
+    do {                           \
+    } while (false)
+#endif
+
+namespace network::ip4::fragment {
+#if !defined(CONFIG_NET_IP4_REASSEMBLY_BLOCKS)
+static constexpr uint32_t kBlocks = 2; ///< network::memory blocks per datagram
+#else
+static constexpr uint32_t kBlocks = CONFIG_NET_IP4_REASSEMBLY_BLOCKS;
+#endif
+
+#if !defined(CONFIG_NET_IP4_REASSEMBLY_TIMEOUT)
+static constexpr uint32_t kTimeout = 2; ///< Seconds
+#else
+static constexpr uint32_t kTimeout = CONFIG_NET_IP4_REASSEMBLY_TIMEOUT;
+#endif
+
+/*
+ * The reassembly buffer comes from the same pool as the ARP queue and the
+ * TCP buffers. Only one datagram is reassembled at a time, and it takes at
+ * most half of the pool. Fragments of another datagram are dropped meanwhile.
+ */
+static constexpr uint32_t kSlots = 1; ///< Datagrams reassembled at the same time
+static_assert((kBlocks * 2) <= network::memory::kBlocks);
+
+static constexpr uint32_t kTimerInterval = 1000; ///< 1 second
+static constexpr uint32_t kBufferSize = kBlocks * network::memory::kBlockSize;
+static constexpr uint32_t kHeadersSize = sizeof(struct network::ip4::Header);
+static constexpr uint32_t kPayloadMax = kBufferSize - kHeadersSize;
+static constexpr uint32_t kUnits = (kPayloadMax + 7) / 8;
+
+// A reassembled datagram is handed to the UDP callbacks, which may use the full kDataSize
+static_assert(kBufferSize >= sizeof(struct network::udp::Header));
+
+/*
+ * The buffer holds the Ethernet and IPv4 header of the first fragment,
+ * followed by the payload. The bitmap has a bit for each 8-byte unit
+ * of payload received, so duplicates are counted only once.
+ */
+struct Slot {
+    uint8_t* buffer;
+    uint32_t source_ip;
+    uint32_t millis;
+    uint16_t id;
+    uint16_t total;
+    uint16_t units;
+    uint16_t age;
+    uint32_t received[(kUnits + 31) / 32];
+};
+
+static Slot s_slots[kSlots] SECTION_NETWORK ALIGNED;
+static uint32_t s_memory;
+static TimerHandle_t s_timer_handle = kTimerIdNone;
+
+namespace globals {
+struct Counters counter;
+} // namespace globals
+
+/*
+ * The timer only runs while a datagram is being reassembled.
+ * It is deleted with the last slot, also from within its own callback.
+ */
+static void StopTimer() {
+    if ((s_memory == 0) && (s_timer_handle != kTimerIdNone)) {
+        SoftwareTimerDelete(s_timer_handle);
+    }
+}
+
+static void Release(Slot& slot) {
+    network::memory::Allocator::Instance().FreeContiguous(slot.buffer, kBlocks);
+    slot.buffer = nullptr;
+    s_memory -= kBufferSize;
+
+    StopTimer();
+}
+
+static Slot* FindSlot(uint32_t source_ip, uint16_t id) {
+    for (auto& slot : s_slots) {
+        if ((slot.buffer != nullptr) && (slot.source_ip == source_ip) && (slot.id == id)) {
+            return &slot;
+        }
+    }
+
+    return nullptr;
+}
+
+static void Timer([[maybe_unused]] TimerHandle_t handle) {
+    for (auto& slot : s_slots) {
+        if ((slot.buffer != nullptr) && (++slot.age > kTimeout)) {
+            FRAGMENT_DEBUG_PRINTF("Timeout " IPSTR " id=%u", IP2STR(slot.source_ip), static_cast<unsigned>(__builtin_bswap16(slot.id)));
+            globals::counter.timeout++;
+            Release(slot);
+        }
+    }
+}
+
+static Slot* NewSlot(uint32_t source_ip, uint16_t id) {
+    // Without the timer an incomplete datagram would never be released
+    if (s_timer_handle == kTimerIdNone) {
+        s_timer_handle = SoftwareTimerAdd(kTimerInterval, Timer);
+
+        if (s_timer_handle == kTimerIdNone) {
+            FRAGMENT_DEBUG_PRINTF("No timer");
+            return nullptr;
+        }
+    }
+
+    for (auto& slot : s_slots) {
+        if (slot.buffer == nullptr) {
+            slot.buffer = network::memory::Allocator::Instance().AllocateContiguous(kBlocks);
+
+            if (slot.buffer == nullptr) {
+                StopTimer();
+                return nullptr;
+            }
+
+            slot.source_ip = source_ip;
+            slot.millis = timing::Millis();
+            slot.id = id;
+            slot.total = 0;
+            slot.units = 0;
+            slot.age = 0;
+            std::memset(slot.received, 0, sizeof(slot.received));
+
+            s_memory += kBufferSize;
+
+            if (s_memory > globals::counter.memory_max) {
+                globals::counter.memory_max = s_memory;
+            }
+
+            return &slot;
+        }
+    }
+
+    globals::counter.busy++;
+
+    return nullptr;
+}
+
+static void Deliver(Slot& slot) {
+    auto* datagram = reinterpret_cast<struct network::udp::Header*>(slot.buffer);
+
+    datagram->ip4.len = __builtin_bswap16(static_cast<uint16_t>(slot.total + network::ip4::kHeaderSize));
+    datagram->ip4.flags_froff = 0;
+
+    const auto kUdpLength = __builtin_bswap16(datagram->udp.len);
+
+    if ((kUdpLength < network::udp::kHeaderSize) || (kUdpLength > slot.total)) {
+        globals::counter.dropped++;
+        return;
+    }
+
+    // The checksum offload engine only sees the fragments, so the checksum is verified here
+    if (datagram->udp.checksum != 0) {
+        const uint32_t kPseudo[3] = {network::MemcpyIp(datagram->ip4.src), network::MemcpyIp(datagram->ip4.dst),
+                                     __builtin_bswap32((static_cast<uint32_t>(network::ip4::Proto::kUdp) << 16) | kUdpLength)};
+        const auto kSum = network::ChksumAdd(kPseudo, sizeof(kPseudo));
+
+        if (network::ChksumAdd(&datagram->udp, kUdpLength, kSum) != 0xFFFF) {
+            FRAGMENT_DEBUG_PRINTF("Checksum error");
+            globals::counter.dropped++;
+            return;
+        }
+    }
+
+    const auto kLatency = timing::Millis() - slot.millis;
+
+    if (kLatency > globals::counter.latency_max) {
+        globals::counter.latency_max = kLatency;
+    }
+
+    globals::counter.reassembled++;
+
+    network::udp::InputReassembled(datagram);
+}
+
+void Init() {
+    for (auto& slot : s_slots) {
+        slot.buffer = nullptr;
+    }
+
+    s_memory = 0;
+
+    StopTimer();
+}
+
+/*
+ * Only UDP datagrams are reassembled. The fragment is copied into the
+ * reassembly buffer, so the EMAC receive buffer is released first.
+ */
+void Input(const struct network::ip4::Header* frame) {
+    auto& counter = globals::counter;
+    counter.received++;
+
+    const auto kFlagsOffset = __builtin_bswap16(frame->ip4.flags_froff);
+    const auto kOffset = static_cast<uint32_t>(kFlagsOffset & network::ip4::Flags::kOffsetMask) << 3;
+    const auto kIsLast = ((kFlagsOffset & network::ip4::Flags::kFlagMf) == 0);
+    const auto kHeaderLength = static_cast<uint32_t>(frame->ip4.ver_ihl & 0x0F) << 2;
+    const auto kTotalLength = static_cast<uint32_t>(__builtin_bswap16(frame->ip4.len));
+
+    if (__builtin_expect(((frame->ip4.proto != network::ip4::Proto::kUdp) || (kHeaderLength != network::ip4::kHeaderSize) || (kTotalLength <= kHeaderLength)), 0)) {
+        counter.dropped++;
+        emac::eth::FreePkt();
+        return;
+    }
+
+    const auto kLength = kTotalLength - kHeaderLength;
+    const auto kSourceIp = network::MemcpyIp(frame->ip4.src);
+    auto* slot = FindSlot(kSourceIp, frame->ip4.id);
+
+    // All fragments but the last carry a multiple of 8 bytes
+    if (__builtin_expect((((kOffset + kLength) > kPayloadMax) || (!kIsLast && ((kLength & 7) != 0))), 0)) {
+        FRAGMENT_DEBUG_PRINTF("Invalid %u:%u", static_cast<unsigned>(kOffset), static_cast<unsigned>(kLength));
+        counter.dropped++;
+        emac::eth::FreePkt();
+
+        if (slot != nullptr) {
+            Release(*slot);
+        }
+        return;
+    }
+
+    if (slot == nullptr) {
+        slot = NewSlot(kSourceIp, frame->ip4.id);
+
+        if (slot == nullptr) {
+            counter.dropped++;
+            emac::eth::FreePkt();
+            return;
+        }
+    }
+
+    if (kOffset == 0) {
+        std::memcpy(slot->buffer, frame, kHeadersSize);
+    }
+
+    std::memcpy(&slot->buffer[kHeadersSize + kOffset], reinterpret_cast<const uint8_t*>(&frame->ip4) + kHeaderLength, kLength);
+
+    emac::eth::FreePkt();
+
+    const auto kLastUnit = (kOffset + kLength + 7) >> 3;
+
+    for (auto unit = kOffset >> 3; unit < kLastUnit; unit++) {
+        auto& word = slot->received[unit >> 5];
+        const auto kBit = 1U << (unit & 31);
+
+        if ((word & kBit) == 0) {
+            word |= kBit;
+            slot->units++;
+        }
+    }
+
+    if (kIsLast) {
+        slot->total = static_cast<uint16_t>(kOffset + kLength);
+    }
+
+    if ((slot->total != 0) && (slot->units == ((slot->total + 7U) >> 3))) {
+        Deliver(*slot);
+        Release(*slot);
+    }
+}
+} // namespace network::ip4::fragment
+
+#if !defined(CONFIG_REMOTECONFIG_MINIMUM)
+#pragma GCC pop_options
+#endif
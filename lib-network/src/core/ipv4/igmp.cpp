@@ -89,10 +89,92 @@ union pcast32 {
 static struct Header s_report SECTION_NETWORK ALIGNED;
 static struct Header s_leave SECTION_NETWORK ALIGNED;
 static uint8_t s_multicast_mac[network::ethernet::kAddressLength] SECTION_NETWORK ALIGNED;
+/*
+ * Open addressing hash table (linear probing) group -> index in s_groups.
+ * The key is the 23-bit suffix of the multicast MAC address, so the groups
+ * sharing a MAC address (RFC 1112, 32 groups per address) share a probe
+ * sequence, and a frame for a MAC address that is not joined, let through by
+ * the 64-bin EMAC hash filter, is rejected on the first empty slot.
+ */
+static constexpr uint32_t kHashBits = (32U - static_cast<uint32_t>(__builtin_clz(IGMP_MAX_JOINS_ALLOWED))) + 1U;
+static constexpr uint32_t kHashSize = 1U << kHashBits;
+static constexpr uint32_t kHashMask = kHashSize - 1U;
+static constexpr uint8_t kHashEmpty = 0xFF;
+
+static_assert(kHashSize >= (2 * IGMP_MAX_JOINS_ALLOWED));
+static_assert(IGMP_MAX_JOINS_ALLOWED < kHashEmpty);
+
 static struct GroupInfo s_groups[IGMP_MAX_JOINS_ALLOWED] SECTION_NETWORK ALIGNED;
+static uint8_t s_group_hash[kHashSize] SECTION_NETWORK ALIGNED;
 static uint16_t s_id SECTION_NETWORK ALIGNED;
 static TimerHandle_t s_timer_id;
 
+namespace globals {
+struct Counters counter;
+} // namespace globals
+
+// The group address is in network byte order, the MAC suffix is (ip[1] & 0x7F), ip[2], ip[3].
+static constexpr uint32_t MacSuffix(uint32_t group_address) {
+    return (group_address & 0xFFFF7F00) >> 8;
+}
+
+static constexpr uint32_t Hash(uint32_t group_address) {
+    return (MacSuffix(group_address) * 0x9E3779B1U) >> (32U - kHashBits);
+}
+
+/*
+ * Returns the index in s_groups, or -1. On a miss, slot is the first free
+ * slot of the probe sequence, and is_alias tells whether a joined group has
+ * the same MAC address.
+ */
+static int32_t Find(uint32_t group_address, uint32_t& slot, bool& is_alias) {
+    slot = Hash(group_address);
+    is_alias = false;
+
+    int32_t index = -1;
+    uint32_t probes = 1;
+
+    while (s_group_hash[slot] != kHashEmpty) {
+        const auto kIndex = s_group_hash[slot];
+        const auto kGroupAddress = s_groups[kIndex].group_address;
+
+        if (kGroupAddress == group_address) {
+            index = kIndex;
+            break;
+        }
+
+        is_alias |= (MacSuffix(kGroupAddress) == MacSuffix(group_address));
+
+        slot = (slot + 1) & kHashMask;
+        probes++;
+    }
+
+    if (__builtin_expect((probes > globals::counter.probes_max), 0)) {
+        globals::counter.probes_max = probes;
+    }
+
+    return index;
+}
+
+// Backward shift deletion, no tombstones are needed.
+static void HashRemove(uint32_t slot) {
+    auto hole = slot;
+    auto next = (slot + 1) & kHashMask;
+
+    while (s_group_hash[next] != kHashEmpty) {
+        const auto kHome = Hash(s_groups[s_group_hash[next]].group_address);
+
+        if (((next - kHome) & kHashMask) >= ((next - hole) & kHashMask)) {
+            s_group_hash[hole] = s_group_hash[next];
+            hole = next;
+        }
+
+        next = (next + 1) & kHashMask;
+    }
+
+    s_group_hash[hole] = kHashEmpty;
+}
+
 static void SendReport(uint32_t group_address) {
     IGMP_DEBUG_ENTRY();
     pcast32 multicast_ip;
@@ -152,6 +234,8 @@ static void Timer([[maybe_unused]] TimerHandle_t handle) {
 }
 
 void __attribute__((cold)) Init() {
+    std::memset(s_group_hash, kHashEmpty, sizeof(s_group_hash));
+
     s_multicast_mac[0] = 0x01;
     s_multicast_mac[1] = 0x00;
     s_multicast_mac[2] = 0x5E;
@@ -255,6 +339,17 @@ static void SendLeave(uint32_t group_address) {
     IGMP_DEBUG_EXIT();
 }
 
+static void QueryGroup(struct GroupInfo& group, uint8_t max_resp_time) {
+    if (group.state == kDelayingMember) {
+        if (max_resp_time < group.timer) {
+            group.timer = (1 + max_resp_time / 2);
+        }
+    } else { // s_groups[s_joins_allowed_index].state == IDLE_MEMBER
+        group.state = kDelayingMember;
+        group.timer = (1 + max_resp_time / 2);
+    }
+}
+
 __attribute__((hot)) void Input(const struct Header* p_igmp) {
     IGMP_DEBUG_ENTRY();
 
@@ -270,23 +365,19 @@ __attribute__((hot)) void Input(const struct Header* p_igmp) {
             is_general_request = true;
         }
 
-        for (auto& group : s_groups) {
-            if (group.group_address == 0) {
-                continue;
+        if (is_general_request) {
+            for (auto& group : s_groups) {
+                if (group.group_address != 0) {
+                    QueryGroup(group, p_igmp->igmp.igmp.max_resp_time);
+                }
             }
+        } else {
+            uint32_t slot;
+            bool is_alias;
+            const auto kIndex = Find(network::MemcpyIp(p_igmp->ip4.dst), slot, is_alias);
 
-            pcast32 group_address;
-            group_address.u32 = group.group_address;
-
-            if (is_general_request || (memcmp(p_igmp->ip4.dst, group_address.u8, network::ip4::kAddressLength) == 0)) {
-                if (group.state == kDelayingMember) {
-                    if (p_igmp->igmp.igmp.max_resp_time < group.timer) {
-                        group.timer = (1 + p_igmp->igmp.igmp.max_resp_time / 2);
-                    }
-                } else { // s_groups[s_joins_allowed_index].state == IDLE_MEMBER
-                    group.state = kDelayingMember;
-                    group.timer = (1 + p_igmp->igmp.igmp.max_resp_time / 2);
-                }
+            if (kIndex >= 0) {
+                QueryGroup(s_groups[kIndex], p_igmp->igmp.igmp.max_resp_time);
             }
         }
     }
@@ -326,17 +417,23 @@ void static Join(uint32_t group_address) {
         return;
     }
 
-    for (int i = 0; i < IGMP_MAX_JOINS_ALLOWED; i++) {
-        if (s_groups[i].group_address == group_address) {
-            IGMP_DEBUG_EXIT();
-            return;
-        }
+    uint32_t slot;
+    bool is_alias;
+
+    if (Find(group_address, slot, is_alias) >= 0) {
+        IGMP_DEBUG_EXIT();
+        return;
+    }
 
+    for (int i = 0; i < IGMP_MAX_JOINS_ALLOWED; i++) {
         if (s_groups[i].group_address == 0) {
             s_groups[i].group_address = group_address;
             s_groups[i].state = kDelayingMember;
             s_groups[i].timer = 2; // TODO(avv):
 
+            // Find() has returned the first free slot of the probe sequence
+            s_group_hash[slot] = static_cast<uint8_t>(i);
+
 #if defined(CONFIG_EMAC_HASH_MULTICAST_FILTER)
             pcast32 multicast_ip;
             multicast_ip.u32 = group_address;
@@ -359,20 +456,26 @@ static void Leave(uint32_t group_address) {
     IGMP_DEBUG_ENTRY();
     IGMP_DEBUG_PRINTF(IPSTR, IP2STR(group_address));
 
-    for (auto& group : s_groups) {
-        if (group.group_address == group_address) {
-            SendLeave(group.group_address);
+    uint32_t slot;
+    bool is_alias;
+    const auto kIndex = Find(group_address, slot, is_alias);
+
+    if (kIndex >= 0) {
+        auto& group = s_groups[kIndex];
+
+        SendLeave(group.group_address);
+
+        HashRemove(slot);
 
-            group.group_address = 0;
-            group.state = kNonMember;
-            group.timer = 0;
+        group.group_address = 0;
+        group.state = kNonMember;
+        group.timer = 0;
 
 #if defined(CONFIG_EMAC_HASH_MULTICAST_FILTER)
-            ResetHash();
+        ResetHash();
 #endif
-            IGMP_DEBUG_EXIT();
-            return;
-        }
+        IGMP_DEBUG_EXIT();
+        return;
     }
 
 	ERROR("Group address not found.\n");
@@ -389,19 +492,29 @@ void LeaveGroup([[maybe_unused]] int32_t handle, uint32_t group_address) {
     Leave(group_address);
 }
 
-bool LookupGroup(uint32_t group_address) {
+__attribute__((hot)) bool LookupGroup(uint32_t group_address) {
     IGMP_DEBUG_ENTRY();
     IGMP_DEBUG_PRINTF(IPSTR, IP2STR(group_address));
 
-    for (auto& group : s_groups) {
-        if (group.group_address == group_address) {
-            IGMP_DEBUG_EXIT();
-            return true;
-        }
+    auto& counter = globals::counter;
+
+    uint32_t slot;
+    bool is_alias;
+
+    if (__builtin_expect((Find(group_address, slot, is_alias) >= 0), 1) || (group_address == network::ConvertToUint(224, 0, 0, 1))) {
+        counter.accepted++;
+        IGMP_DEBUG_EXIT();
+        return true;
+    }
+
+    if (is_alias) {
+        counter.rejected_alias++;
+    } else {
+        counter.rejected_hash++;
     }
 
     IGMP_DEBUG_EXIT();
-    return (group_address == network::ConvertToUint(224, 0, 0, 1));
+    return false;
 }
 
 void ReportGroups() {
@@ -28,4 +28,5 @@
 
 namespace network::memory {
 uint8_t pool[kBlocks][kBlockSize] SECTION_NETWORK __attribute__((aligned(4)));
+uint8_t pool_small[(kSmallBlocks != 0) ? kSmallBlocks : 1][kSmallBlockSize] SECTION_NETWORK __attribute__((aligned(4)));
 } // namespace network::memory
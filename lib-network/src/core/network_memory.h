@@ -52,8 +52,43 @@ inline constexpr uint32_t kBlockSize =
 
 static_assert((kBlockSize % 4) == 0);
 
+/*
+ * Small size class, for allocations that do not need a full block,
+ * such as short TCP segments. With 0 blocks the class is disabled.
+ */
+inline constexpr uint32_t kSmallBlocks =
+#if !defined(CONFIG_NETWORK_MEMORY_SMALL_BLOCKS)
+    8;
+#else
+    CONFIG_NETWORK_MEMORY_SMALL_BLOCKS;
+#endif
+
+static_assert(kSmallBlocks <= 32);
+
+inline constexpr uint32_t kSmallBlockSize =
+#if !defined(CONFIG_NETWORK_MEMORY_SMALL_BLOCKSIZE)
+    256;
+#else
+    CONFIG_NETWORK_MEMORY_SMALL_BLOCKSIZE;
+#endif
+
+static_assert((kSmallBlockSize % 4) == 0);
+static_assert(kSmallBlockSize < kBlockSize);
+
 extern uint8_t pool[kBlocks][kBlockSize] __attribute__((aligned(4)));
+extern uint8_t pool_small[(kSmallBlocks != 0) ? kSmallBlocks : 1][kSmallBlockSize] __attribute__((aligned(4)));
 
+struct Counters {
+    uint32_t blocks_max;   ///< Blocks in use, high-water mark
+    uint32_t blocks_fail;  ///< Failed block allocations
+    uint32_t small_max;    ///< Small blocks in use, high-water mark
+    uint32_t small_fail;   ///< Failed small block allocations, served by a block when possible
+};
+
+/*
+ * Blocks are indexed 0 .. kBlocks - 1, small blocks kBlocks .. kBlocks + kSmallBlocks - 1.
+ * The owning block of a pointer is found from its offset in the pool.
+ */
 class Allocator {
    public:
     static Allocator& Instance() {
@@ -70,7 +105,8 @@ class Allocator {
     }
 
     void Init() {
-        free_mask_ = kAllMask;
+        large_.free_mask = kAllMask;
+        small_.free_mask = kSmallAllMask;
         std::memset(size_, 0, sizeof(size_));
     }
 
@@ -79,55 +115,106 @@ class Allocator {
     Allocator(Allocator&&) = delete;
     Allocator& operator=(Allocator&&) = delete;
 
-    bool IsEmpty() const { return free_mask_ == kAllMask; }
-    bool IsFull() const { return free_mask_ == 0; }
+    bool IsEmpty() const { return large_.free_mask == kAllMask; }
+    bool IsFull() const { return large_.free_mask == 0; }
 
     uint8_t* Allocate() {
-        if (IsFull()) {
+        const auto kIndex = Take(large_, kAllMask);
+
+        if (kIndex < 0) {
             network::Error(__func__, "Allocate:Full!");
             return nullptr;
         }
 
-        const uint32_t kIndex = static_cast<uint32_t>(__builtin_ctz(free_mask_));
-        free_mask_ &= ~(1U << kIndex);
-
         Status();
 
         return pool[kIndex];
     }
 
+    /**
+     * @brief Allocates from the smallest size class that fits.
+     *
+     * @param size Number of bytes, at most kBlockSize.
+     * @return Pointer to the memory, or nullptr.
+     */
+    uint8_t* Allocate(uint32_t size) {
+        assert(size <= kBlockSize);
+
+        const auto kIndex = TakeSized(size);
+
+        if (kIndex < 0) {
+            network::Error(__func__, "Allocate:Full!");
+            return nullptr;
+        }
+
+        Status();
+
+        return Pointer(static_cast<uint32_t>(kIndex));
+    }
+
     uint16_t Allocate(const uint8_t* data, uint16_t size) {
         assert(data != nullptr);
         assert(size > 0);
         assert(size <= kBlockSize);
 
-        if (IsFull()) {
+        const auto kIndex = TakeSized(size);
+
+        if (kIndex < 0) {
             network::Error(__func__, "Allocate:Full!");
             return UINT16_MAX;
         }
 
-        const uint32_t kIndex = static_cast<uint32_t>(__builtin_ctz(free_mask_));
-        free_mask_ &= ~(1U << kIndex);
-
         size_[kIndex] = size;
-        memcpy(pool[kIndex], data, size);
+        memcpy(Pointer(static_cast<uint32_t>(kIndex)), data, size);
 
         Status();
 
         return static_cast<uint16_t>(kIndex);
     }
 
-    void Free(void* pointer) {
+    /**
+     * @brief Allocates adjacent blocks, used as one buffer of count * kBlockSize bytes.
+     *
+     * @param count Number of blocks.
+     * @return Pointer to the first block, or nullptr when there is no free run.
+     */
+    uint8_t* AllocateContiguous(uint32_t count) {
+        assert(count >= 1);
+        assert(count <= kBlocks);
+
+        const uint32_t kRun = (count == 32) ? UINT32_MAX : ((1U << count) - 1U);
+
+        for (uint32_t index = 0; (index + count) <= kBlocks; ++index) {
+            const auto kMask = kRun << index;
+
+            if ((large_.free_mask & kMask) == kMask) {
+                large_.free_mask &= ~kMask;
+                Used(large_, kAllMask);
+                Status();
+                return pool[index];
+            }
+        }
+
+        large_.failed++;
+        return nullptr;
+    }
+
+    void FreeContiguous(void* pointer, uint32_t count) {
         assert(pointer != nullptr);
 
-        for (uint32_t index = 0; index < kBlocks; ++index) {
-            if (static_cast<void*>(pool[index]) == pointer) {
-                Free(static_cast<uint16_t>(index));
-                return;
-            }
+        const auto kIndex = Index(pointer);
+        assert(kIndex < kBlocks);
+        assert((kIndex + count) <= kBlocks);
+
+        for (uint32_t i = 0; i < count; ++i) {
+            Free(static_cast<uint16_t>(kIndex + i));
         }
+    }
 
-        assert(false && "Pointer is not from pool");
+    void Free(void* pointer) {
+        assert(pointer != nullptr);
+
+        Free(static_cast<uint16_t>(Index(pointer)));
     }
 
     void Free(uint16_t index) {
@@ -135,11 +222,12 @@ class Allocator {
             return;
         }
 
-        assert(index < kBlocks);
+        assert(index < (kBlocks + kSmallBlocks));
 
-        const uint32_t kBit = (1U << index);
-        assert(((free_mask_ & kBit) == 0) && "Double free");
-        free_mask_ |= kBit;
+        auto& size_class = (index < kBlocks) ? large_ : small_;
+        const uint32_t kBit = (1U << ((index < kBlocks) ? index : (index - kBlocks)));
+        assert(((size_class.free_mask & kBit) == 0) && "Double free");
+        size_class.free_mask |= kBit;
 
         size_[index] = 0;
 
@@ -147,26 +235,96 @@ class Allocator {
     }
 
     uint8_t* Get(uint16_t index, uint32_t& size) {
-        assert(index < kBlocks);
+        assert(index < (kBlocks + kSmallBlocks));
         assert(size_[index] != 0);
 
         size = size_[index];
-        return pool[index];
+        return Pointer(index);
+    }
+
+    void GetCounters(Counters& counters) const {
+        counters.blocks_max = large_.used_max;
+        counters.blocks_fail = large_.failed;
+        counters.small_max = small_.used_max;
+        counters.small_fail = small_.failed;
     }
 
     void Status() const {
 #if defined DEBUG_NETWORK_MEMORY
-        const uint32_t kUsedMask = (~free_mask_) & kAllMask;
-        printf("free_mask=0x%08x used_mask=0x%08x free=%u used=%u\n", free_mask_, kUsedMask, __builtin_popcount(free_mask_), __builtin_popcount(kUsedMask));
+        const uint32_t kUsedMask = (~large_.free_mask) & kAllMask;
+        printf("free_mask=0x%08x used_mask=0x%08x free=%u used=%u\n", large_.free_mask, kUsedMask, __builtin_popcount(large_.free_mask), __builtin_popcount(kUsedMask));
+        printf("small free_mask=0x%08x\n", small_.free_mask);
         printf("IsEmpty=%c IsFull=%c\n", IsEmpty() ? 'Y' : 'N', IsFull() ? 'Y' : 'N');
 #endif
     }
 
    private:
+    struct SizeClass {
+        uint32_t free_mask;
+        uint32_t used_max;
+        uint32_t failed;
+    };
+
     Allocator() = default;
+
+    static void Used(SizeClass& size_class, uint32_t all_mask) {
+        const auto kUsed = static_cast<uint32_t>(__builtin_popcount(~size_class.free_mask & all_mask));
+
+        if (kUsed > size_class.used_max) {
+            size_class.used_max = kUsed;
+        }
+    }
+
+    static int32_t Take(SizeClass& size_class, uint32_t all_mask) {
+        if (size_class.free_mask == 0) {
+            size_class.failed++;
+            return -1;
+        }
+
+        const auto kBit = static_cast<uint32_t>(__builtin_ctz(size_class.free_mask));
+        size_class.free_mask &= ~(1U << kBit);
+
+        Used(size_class, all_mask);
+
+        return static_cast<int32_t>(kBit);
+    }
+
+    // Small requests fall back to a block when the small class is exhausted
+    int32_t TakeSized(uint32_t size) {
+        if ((kSmallBlocks != 0) && (size <= kSmallBlockSize)) {
+            const auto kIndex = Take(small_, kSmallAllMask);
+
+            if (kIndex >= 0) {
+                return static_cast<int32_t>(kBlocks) + kIndex;
+            }
+        }
+
+        return Take(large_, kAllMask);
+    }
+
+    static uint8_t* Pointer(uint32_t index) {
+        return (index < kBlocks) ? pool[index] : pool_small[index - kBlocks];
+    }
+
+    static uint32_t Index(const void* pointer) {
+        const auto* p = static_cast<const uint8_t*>(pointer);
+
+        if ((p >= &pool[0][0]) && (p < &pool[kBlocks][0])) {
+            const auto kOffset = static_cast<uint32_t>(p - &pool[0][0]);
+            assert((kOffset % kBlockSize) == 0 && "Pointer is not from pool");
+            return kOffset / kBlockSize;
+        }
+
+        const auto kOffset = static_cast<uint32_t>(p - &pool_small[0][0]);
+        assert((kOffset < (kSmallBlocks * kSmallBlockSize)) && ((kOffset % kSmallBlockSize) == 0) && "Pointer is not from pool");
+        return kBlocks + (kOffset / kSmallBlockSize);
+    }
+
     static constexpr uint32_t kAllMask = (kBlocks == 32) ? UINT32_MAX : ((1U << kBlocks) - 1U);
-    uint32_t free_mask_{0};
-    uint16_t size_[kBlocks]{0};
+    static constexpr uint32_t kSmallAllMask = (kSmallBlocks == 32) ? UINT32_MAX : ((1U << kSmallBlocks) - 1U);
+    SizeClass large_{0, 0, 0};
+    SizeClass small_{0, 0, 0};
+    uint16_t size_[kBlocks + kSmallBlocks]{0};
 };
 } // namespace network::memory
 
@@ -42,13 +42,16 @@
 
 namespace emac::eth {
 uint8_t* SendGetDmaBuffer();
+bool IsSendDmaBuffer(const void*);
 void Send(uint32_t);
 void Send(void*, uint32_t);
+void SendFragment(uint32_t);
 #if defined CONFIG_NET_ENABLE_PTP
 void SendTimestamp(uint32_t);
 void SendTimestamp(void*, uint32_t);
 #endif
 uint32_t Recv(uint8_t**);
+void RecvBatch(uint32_t);
 void FreePkt();
 } // namespace emac::eth
 
@@ -64,32 +67,72 @@ extern uint32_t broadcast_mask;
 extern uint32_t on_network_mask;
 } // namespace global
 
-inline uint16_t Chksum(const void* data, uint32_t length) {
+/**
+ * @brief Ones' complement sum (RFC 1071), not complemented.
+ *
+ * Used by the software checksum path, when CHECKSUM_BY_HARDWARE is not set,
+ * and for the TCP/UDP pseudo header. The data is summed a 32-bit word at a
+ * time, 16 bytes per iteration, into a 64-bit accumulator, so that the carries
+ * are folded only once at the end. The headers are at least 16-bit aligned.
+ *
+ * @param data Pointer to the data, 16-bit aligned.
+ * @param length Number of bytes.
+ * @param sum Partial sum of a previous call, or 0.
+ * @return The folded 16-bit sum.
+ */
+inline uint32_t ChksumAdd(const void* data, uint32_t length, uint32_t sum = 0) {
     const auto* ptr = reinterpret_cast<const uint16_t*>(data);
-    uint32_t sum = 0;
+    uint64_t acc = sum;
+
+    // Align to 32-bit
+    if ((length > 1) && ((reinterpret_cast<uintptr_t>(ptr) & 2) != 0)) {
+        acc += *ptr++;
+        length -= 2;
+    }
+
+    const auto* ptr32 = reinterpret_cast<const uint32_t*>(ptr);
+
+    while (length >= 16) {
+        acc += static_cast<uint64_t>(ptr32[0]) + ptr32[1];
+        acc += static_cast<uint64_t>(ptr32[2]) + ptr32[3];
+        ptr32 += 4;
+        length -= 16;
+    }
+
+    while (length >= 4) {
+        acc += *ptr32++;
+        length -= 4;
+    }
 
-    while (length > 1) {
-        sum += *ptr;
-        ptr++;
+    ptr = reinterpret_cast<const uint16_t*>(ptr32);
+
+    if (length > 1) {
+        acc += *ptr++;
         length -= 2;
     }
 
     // Add left-over byte, if any
     if (length > 0) {
-        sum += __builtin_bswap16(static_cast<uint16_t>(*(reinterpret_cast<const uint8_t*>(ptr)) << 8));
+        acc += __builtin_bswap16(static_cast<uint16_t>(*(reinterpret_cast<const uint8_t*>(ptr)) << 8));
     }
 
-    // Fold 32-bit sum into 16 bits
-    while ((sum >> 16) != 0) {
-        sum = (sum >> 16) + (sum & 0xFFFF);
-    }
+    // Fold 64-bit sum into 16 bits
+    acc = (acc >> 32) + (acc & 0xFFFFFFFF);
+    acc = (acc >> 32) + (acc & 0xFFFFFFFF);
+    acc = (acc >> 16) + (acc & 0xFFFF);
+    acc = (acc >> 16) + (acc & 0xFFFF);
 
-    return static_cast<uint16_t>(~sum);
+    return static_cast<uint32_t>(acc);
+}
+
+inline uint16_t Chksum(const void* data, uint32_t length) {
+    return static_cast<uint16_t>(~ChksumAdd(data, length));
 }
 
 namespace arp {
 enum class EthSend {
-    kIsNormal
+    kIsNormal,
+    kIsFragment
 #if defined CONFIG_NET_ENABLE_PTP
     ,
     kIsTimestamp
@@ -103,6 +146,11 @@ void Shutdown();
 void Handle(struct Header*);
 } // namespace ip
 
+namespace ip4::fragment {
+void Init();
+void Input(const struct ip4::Header*);
+} // namespace ip4::fragment
+
 namespace igmp {
 void Init();
 void Input(const struct Header*);
@@ -117,6 +165,7 @@ void Shutdown();
 namespace udp {
 void Init();
 void Input(const struct Header*);
+void InputReassembled(const struct Header*);
 void Shutdown();
 } // namespace udp
 
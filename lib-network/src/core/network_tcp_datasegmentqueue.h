@@ -34,19 +34,22 @@
 #include "network_memory.h"
 
 namespace network::tcp::datasegment {
+// The buffer is last, a node is allocated for the length of its segment only.
 struct NodeData {
-    uint8_t buffer[kTcpDataMss];
     uint32_t length;
     bool is_last_segment;
+    uint8_t buffer[kTcpDataMss];
 };
 
 struct Node {
-    NodeData node_data;
     Node* next;
+    NodeData node_data;
 };
 
 static_assert(sizeof(Node) <= network::memory::kBlockSize);
 
+inline constexpr uint32_t kNodeHeaderSize = sizeof(Node) - kTcpDataMss;
+
 class Queue {
    public:
     Queue() = default;
@@ -55,7 +58,7 @@ class Queue {
     Queue(Queue&&) = delete;
     Queue& operator=(Queue&&) = delete;
 
-    bool IsEmpty() const { return !full_ && (front_ == nullptr); }
+    bool IsEmpty() const { return front_ == nullptr; }
 
     bool IsFull() const { return full_; }
 
@@ -64,11 +67,11 @@ class Queue {
         assert(length > 0);
         assert(length <= kTcpDataMss);
 
-        if (IsFull() || (length > kTcpDataMss)) [[unlikely]] {
+        if (length > kTcpDataMss) [[unlikely]] {
             return false;
         }
 
-        auto* add = reinterpret_cast<Node*>(memory::Allocator::Instance().Allocate());
+        auto* add = reinterpret_cast<Node*>(memory::Allocator::Instance().Allocate(kNodeHeaderSize + length));
 
         full_ = (add == nullptr);
 
@@ -106,11 +109,23 @@ class Queue {
             return;
         }
 
+        memory::Allocator::Instance().Free(Detach());
+    }
+
+    // The caller owns the node and returns it with memory::Allocator::Free
+    Node* Detach() {
+        assert(!IsEmpty());
+
         Node* tmp = front_;
         front_ = front_->next;
-        memory::Allocator::Instance().Free(tmp);
+
+        if (front_ == nullptr) {
+            last_ = nullptr;
+        }
 
         full_ = false;
+
+        return tmp;
     }
 
     const NodeData& GetFront() const {
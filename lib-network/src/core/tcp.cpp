@@ -93,13 +93,35 @@
     } while (false)
 #endif
 
+#if !defined(CONFIG_NET_TCP_RX_WINDOW_SEGMENTS)
+// Received data is handed to the callback in Input(), so the window only has to cover the frames held in the EMAC receive ring.
+#define CONFIG_NET_TCP_RX_WINDOW_SEGMENTS 4
+#endif
+
+#if !defined(CONFIG_NET_TCP_UNACK_MAX)
+#define CONFIG_NET_TCP_UNACK_MAX 8
+#endif
+
+#if !defined(CONFIG_NET_TCP_RTO_MIN_MS)
+#define CONFIG_NET_TCP_RTO_MIN_MS 200
+#endif
+
 namespace network::tcp {
-static constexpr auto kAdvertisedRxWnd = kTcpDataMss;
+namespace globals {
+struct Counters counter;
+} // namespace globals
+
+static constexpr uint32_t kAdvertisedRxWnd = CONFIG_NET_TCP_RX_WINDOW_SEGMENTS * kTcpDataMss;
+static_assert(kAdvertisedRxWnd <= UINT16_MAX, "No window scaling");
 // Retransmission support
-static constexpr uint32_t kTcpRtoInitialMs = 1000;
+static constexpr uint32_t kTcpRtoInitialMs = 1000; ///< RFC 6298 2.1, until the first RTT sample
+static constexpr uint32_t kTcpRtoMinMs = CONFIG_NET_TCP_RTO_MIN_MS;
 static constexpr uint32_t kTcpRtoMaxMs = 60000;
 static constexpr uint32_t kTcpRtxMaxRetry = 5;
-static constexpr uint32_t kTcpUnackMax = 8;
+static constexpr uint32_t kTcpUnackMax = CONFIG_NET_TCP_UNACK_MAX;
+static constexpr uint32_t kTcpDupAckThreshold = 3; ///< RFC 5681 3.2 fast retransmit
+
+static_assert(kTcpUnackMax <= UINT8_MAX);
 
 struct RtxSeg {
     uint32_t seq;
@@ -107,8 +129,10 @@ struct RtxSeg {
     uint16_t consumed;
     uint8_t ctl;
     uint8_t retries;
+    bool is_retransmitted; ///< Karn: no RTT sample from this segment
     uint32_t last_sent;
-    uint16_t pool_idx; // 0xFFFF = no payload
+    uint8_t* block; ///< network::memory block owning the payload, nullptr = no payload
+    uint8_t* data;
 };
 
 struct RtxQueue {
@@ -160,6 +184,7 @@ struct Tcb {
     uint16_t SendMSS; // NOLINT
 
     struct {
+        uint8_t* block;
         uint8_t* data;
         uint32_t size;
     } TX; // NOLINT
@@ -180,12 +205,21 @@ struct Tcb {
 
     network::tcp::datasegment::Queue tx_queue;
 
+    // Data of Send() for which no network::memory was left, sent from the caller's buffer after tx_queue
+    struct {
+        const uint8_t* data;
+        uint32_t length;
+    } tx_pending;
+
     uint32_t timewait_deadline;
 
     // Retransmission
     RtxQueue rtx;
     uint32_t rtx_deadline;
     uint32_t rtx_rto;
+    uint32_t srtt;   ///< Smoothed RTT in ms, scaled by 8. 0 = no sample yet
+    uint32_t rttvar; ///< RTT variation in ms, scaled by 4
+    uint8_t dupacks;
 };
 
 struct SendInfo {
@@ -194,12 +228,21 @@ struct SendInfo {
     uint8_t CTL;  // NOLINT
 };
 
+static void RtxFree(Tcb* tcb) {
+    auto& rtx = tcb->rtx.q[tcb->rtx.head];
+
+    if (rtx.block != nullptr) {
+        network::memory::Allocator::Instance().Free(rtx.block);
+        rtx.block = nullptr;
+    }
+
+    tcb->rtx.head = static_cast<uint8_t>((tcb->rtx.head + 1) % kTcpUnackMax);
+    tcb->rtx.count--;
+}
+
 static void RtxClear(Tcb* tcb) {
     while (tcb->rtx.count > 0) {
-        auto& rtx = tcb->rtx.q[tcb->rtx.head];
-        network::memory::Allocator::Instance().Free(rtx.pool_idx);
-        tcb->rtx.head = (tcb->rtx.head + 1) % kTcpUnackMax;
-        tcb->rtx.count--;
+        RtxFree(tcb);
     }
     tcb->rtx_deadline = 0;
 }
@@ -342,6 +385,8 @@ static void TcpInitTcb(struct Tcb* tcb, uint16_t local_port) {
 
     tcb->RCV.WND = kAdvertisedRxWnd;
 
+    tcb->rtx_rto = kTcpRtoInitialMs;
+
     tcb->SND.UNA = tcb->ISS;
     tcb->SND.NXT = tcb->ISS;
     tcb->SND.WL2 = tcb->ISS;
@@ -349,18 +394,53 @@ static void TcpInitTcb(struct Tcb* tcb, uint16_t local_port) {
     NEW_STATE(tcb, kStateListen);
 }
 
+// RFC 6298 2.2 and 2.3, integer form with SRTT scaled by 8 and RTTVAR scaled by 4
+static void RttSample(Tcb* tcb, uint32_t rtt) {
+    rtt = std::max(rtt, 1U);
+
+    if (tcb->srtt == 0) {
+        tcb->srtt = rtt << 3;
+        tcb->rttvar = rtt << 1;
+    } else {
+        const auto kDelta = static_cast<int32_t>(rtt) - static_cast<int32_t>(tcb->srtt >> 3);
+        const auto kAbsDelta = static_cast<uint32_t>((kDelta < 0) ? -kDelta : kDelta);
+        tcb->srtt = static_cast<uint32_t>(static_cast<int32_t>(tcb->srtt) + kDelta);
+        tcb->rttvar = tcb->rttvar + kAbsDelta - (tcb->rttvar >> 2);
+    }
+
+    // RTO = SRTT + max(G, 4 * RTTVAR)
+    const auto kRto = (tcb->srtt >> 3) + std::max(tcb->rttvar, 1U);
+    tcb->rtx_rto = std::min(std::max(kRto, kTcpRtoMinMs), kTcpRtoMaxMs);
+
+    if ((tcb->srtt >> 3) > globals::counter.srtt_max) {
+        globals::counter.srtt_max = tcb->srtt >> 3;
+    }
+}
+
 static void RtxOnAck(Tcb* tcb, uint32_t ack) {
+    uint32_t sent_millis = 0;
+    auto has_sample = false;
+
     while (tcb->rtx.count > 0) {
-        auto& rtx = tcb->rtx.q[tcb->rtx.head];
+        const auto& rtx = tcb->rtx.q[tcb->rtx.head];
         if (Leq(rtx.seq + rtx.consumed, ack)) {
-            memory::Allocator::Instance().Free(rtx.pool_idx);
-            tcb->rtx.head = (tcb->rtx.head + 1) % kTcpUnackMax;
-            tcb->rtx.count--;
+            // Karn's algorithm: only segments sent once give a valid sample
+            if (!rtx.is_retransmitted) {
+                sent_millis = rtx.last_sent;
+                has_sample = true;
+            }
+            RtxFree(tcb);
         } else {
             break;
         }
     }
 
+    tcb->dupacks = 0;
+
+    if (has_sample) {
+        RttSample(tcb, timing::Millis() - sent_millis);
+    }
+
     if (tcb->rtx.count == 0) {
         tcb->rtx_deadline = 0;
     } else {
@@ -385,6 +465,7 @@ __attribute__((cold)) void Init() {
 }
 
 ///< TCP Checksum Pseudo Header
+#if !defined(CHECKSUM_BY_HARDWARE)
 struct TcpPseudo {
     uint8_t src_ip[network::ip4::kAddressLength];
     uint8_t dst_ip[network::ip4::kAddressLength];
@@ -395,26 +476,23 @@ struct TcpPseudo {
 
 static constexpr uint32_t kTcpPseudoLen = 12;
 
-static uint16_t TcpChecksumPseudoHeader(struct Header* eth_frame, const struct Tcb* const kTcb, uint16_t length) {
-    uint8_t buf[kTcpPseudoLen];
-    // Store current data before TCP header in temporary buffer
-    auto* pseu = reinterpret_cast<struct TcpPseudo*>(reinterpret_cast<uint8_t*>(&eth_frame->tcp) - kTcpPseudoLen);
-    memcpy(buf, pseu, kTcpPseudoLen);
+static_assert(sizeof(struct TcpPseudo) == kTcpPseudoLen);
 
-    // Generate TCP psuedo header
-    std::memcpy(pseu->src_ip, kTcb->local_ip, network::ip4::kAddressLength);
-    std::memcpy(pseu->dst_ip, kTcb->remote_ip, network::ip4::kAddressLength);
-    pseu->zero = 0;
-    pseu->proto = network::ip4::Proto::kTcp;
-    pseu->length = __builtin_bswap16(length);
+static uint16_t TcpChecksumPseudoHeader(struct Header* eth_frame, const struct Tcb* const kTcb, uint16_t length) {
+    // The pseudo header is summed separately, the IPv4 header is left untouched
+    struct TcpPseudo pseudo ALIGNED;
 
-    const auto kSum = network::Chksum(pseu, length + kTcpPseudoLen);
+    std::memcpy(pseudo.src_ip, kTcb->local_ip, network::ip4::kAddressLength);
+    std::memcpy(pseudo.dst_ip, kTcb->remote_ip, network::ip4::kAddressLength);
+    pseudo.zero = 0;
+    pseudo.proto = network::ip4::Proto::kTcp;
+    pseudo.length = __builtin_bswap16(length);
 
-    // Restore data before TCP header from temporary buffer
-    memcpy(pseu, buf, kTcpPseudoLen);
+    const auto kSum = network::ChksumAdd(&pseudo, kTcpPseudoLen);
 
-    return kSum;
+    return static_cast<uint16_t>(~network::ChksumAdd(&eth_frame->tcp, length, kSum));
 }
+#endif
 
 static constexpr uint8_t kZeromac[network::ethernet::kAddressLength] = {0, 0, 0, 0, 0, 0};
 
@@ -503,7 +581,9 @@ static void SendSegment(Tcb* tcb, const SendInfo& send_info, bool track_rtx = tr
     s_eth_frame.tcp.window = __builtin_bswap16(s_eth_frame.tcp.window);
     s_eth_frame.tcp.urgent = __builtin_bswap16(s_eth_frame.tcp.urgent);
 
+#if !defined(CHECKSUM_BY_HARDWARE)
     s_eth_frame.tcp.checksum = TcpChecksumPseudoHeader(&s_eth_frame, tcb, static_cast<uint16_t>(kTcpLength));
+#endif
 
     Ip4SendSegment(tcb, reinterpret_cast<void*>(&s_eth_frame), kTcpLength + sizeof(struct network::ip4::Ip4Header) + sizeof(struct ethernet::Header));
 
@@ -517,16 +597,53 @@ static void SendSegment(Tcb* tcb, const SendInfo& send_info, bool track_rtx = tr
         r.consumed = static_cast<uint16_t>(r.len + ((send_info.CTL & Control::SYN) ? 1U : 0) + ((send_info.CTL & Control::FIN) ? 1U : 0));
         r.ctl = send_info.CTL;
         r.retries = 0;
+        r.is_retransmitted = false;
         r.last_sent = timing::Millis();
-        r.pool_idx = (r.len != 0) ? memory::Allocator::Instance().Allocate(tcb->TX.data, r.len) : 0xFFFF;
+        // The segment takes over the payload block, it is freed when acknowledged
+        r.block = (r.len != 0) ? tcb->TX.block : nullptr;
+        r.data = (r.len != 0) ? tcb->TX.data : nullptr;
+        tcb->TX.block = nullptr;
 
         tcb->rtx.count++;
 
         if (tcb->rtx.count == 1) {
-            tcb->rtx_rto = kTcpRtoInitialMs;
             tcb->rtx_deadline = r.last_sent + tcb->rtx_rto;
         }
     }
+
+    assert(tcb->TX.block == nullptr);
+}
+
+// Retransmits the oldest unacknowledged segment
+static void RtxSendHead(Tcb* tcb) {
+    auto& rtx = tcb->rtx.q[tcb->rtx.head];
+
+    SendInfo info;
+    info.SEQ = rtx.seq;
+    info.ACK = tcb->RCV.NXT;
+    info.CTL = rtx.ctl | Control::ACK;
+
+    tcb->TX.data = rtx.data;
+    tcb->TX.size = rtx.len;
+
+    SendSegment(tcb, info, false);
+
+    tcb->TX.data = nullptr;
+    tcb->TX.size = 0;
+
+    rtx.last_sent = timing::Millis();
+    rtx.is_retransmitted = true;
+}
+
+// Usable send window: what the peer allows beyond the bytes in flight, and only with a free retransmission slot
+static uint32_t SendWindow(const Tcb* tcb) {
+    if (tcb->rtx.count >= kTcpUnackMax) {
+        return 0;
+    }
+
+    const auto kInFlight = tcb->SND.NXT - tcb->SND.UNA;
+
+    return (tcb->SND.WND > kInFlight) ? (tcb->SND.WND - kInFlight) : 0;
 }
 
 static void SendReset(struct Header* eth_frame, struct Tcb* const kTcb) {
@@ -564,14 +681,19 @@ static void SendReset(struct Header* eth_frame, struct Tcb* const kTcb) {
     TCP_DEBUG_EXIT();
 }
 
-static bool SendData(struct Tcb* tcb, const uint8_t* buffer, uint32_t length, bool is_last_segment) {
+/**
+ * @param block network::memory block holding the payload, owned by the retransmission queue from here on
+ * @param buffer payload within the block
+ */
+static void SendData(struct Tcb* tcb, uint8_t* block, uint8_t* buffer, uint32_t length, bool is_last_segment) {
     assert(length != 0);
     assert(length <= static_cast<uint32_t>(kTcpDataMss));
-    assert(length <= tcb->SND.WND);
+    assert(length <= SendWindow(tcb));
 
     TCP_DEBUG_PRINTF("length=%u, pTCB->SND.WND=%u", static_cast<unsigned>(length), static_cast<unsigned>(tcb->SND.WND));
 
-    tcb->TX.data = const_cast<uint8_t*>(buffer);
+    tcb->TX.block = block;
+    tcb->TX.data = buffer;
     tcb->TX.size = length;
 
     struct SendInfo info;
@@ -589,9 +711,40 @@ static bool SendData(struct Tcb* tcb, const uint8_t* buffer, uint32_t length, bo
     tcb->TX.size = 0;
 
     tcb->SND.NXT += length;
-    tcb->SND.WND -= length;
+}
+
+/**
+ * Sends the segments of [data, data + length) that fit in the usable window.
+ * The payload is copied into a network::memory block for retransmission. When
+ * none is available it is retransmitted from the caller's buffer instead.
+ * @return the number of bytes sent
+ */
+static uint32_t SendBuffer(struct Tcb* tcb, const uint8_t* data, uint32_t length) {
+    uint32_t sent = 0;
+
+    while (length > 0) {
+        const uint32_t kWriteLen = (length > kTcpDataMss) ? kTcpDataMss : length;
+        const bool kIsLast = (length < kTcpDataMss);
+
+        if (kWriteLen > SendWindow(tcb)) {
+            break;
+        }
 
-    return false;
+        auto* block = memory::Allocator::Instance().Allocate(kWriteLen);
+
+        if (block != nullptr) {
+            memcpy(block, data, kWriteLen);
+            SendData(tcb, block, block, kWriteLen, kIsLast);
+        } else {
+            SendData(tcb, nullptr, const_cast<uint8_t*>(data), kWriteLen, kIsLast);
+        }
+
+        data += kWriteLen;
+        length -= kWriteLen;
+        sent += kWriteLen;
+    }
+
+    return sent;
 }
 
 struct Options {
@@ -691,34 +844,25 @@ __attribute__((hot)) void Run() {
         // Flush per-connection queue
         auto& queue = tcb.tx_queue;
 
-        while (!queue.IsEmpty() && queue.GetFront().length <= tcb.SND.WND) {
-            const auto& seg = queue.GetFront();
-            SendData(&tcb, seg.buffer, seg.length, seg.is_last_segment);
-            queue.Pop();
+        while (!queue.IsEmpty() && queue.GetFront().length <= SendWindow(&tcb)) {
+            auto* node = queue.Detach();
+            auto& seg = node->node_data;
+            SendData(&tcb, reinterpret_cast<uint8_t*>(node), seg.buffer, seg.length, seg.is_last_segment);
+        }
+
+        if (queue.IsEmpty() && tcb.tx_pending.length != 0) {
+            const auto kSent = SendBuffer(&tcb, tcb.tx_pending.data, tcb.tx_pending.length);
+            tcb.tx_pending.data += kSent;
+            tcb.tx_pending.length -= kSent;
         }
 
         // ---- Retransmission timeout ----
         if (tcb.rtx.count > 0 && tcb.rtx_deadline != 0 && timing::Millis() >= tcb.rtx_deadline) {
-            auto& rtx = tcb.rtx.q[tcb.rtx.head];
-
-            SendInfo info;
-            info.SEQ = rtx.seq;
-            info.ACK = tcb.RCV.NXT;
-            info.CTL = rtx.ctl | Control::ACK;
-
-            tcb.TX.data = nullptr;
-            tcb.TX.size = 0;
-
-            if (rtx.pool_idx != 0xFFFF) {
-                tcb.TX.data = memory::Allocator::Instance().Get(rtx.pool_idx, tcb.TX.size);
-            }
+            RtxSendHead(&tcb);
 
-            SendSegment(&tcb, info, false);
+            globals::counter.retransmit++;
 
-            tcb.TX.data = nullptr;
-            tcb.TX.size = 0;
-
-            rtx.last_sent = timing::Millis();
+            auto& rtx = tcb.rtx.q[tcb.rtx.head];
             rtx.retries++;
 
             if (rtx.retries > kTcpRtxMaxRetry) {
@@ -837,9 +981,7 @@ static inline void EnterTimeWait(Tcb* tcb) {
     tcb->timewait_deadline = timing::Millis() + kTimeWaitMs;
 
     // Turn off other timers
-    tcb->rtx.count = 0;    // drop unacked queue
-    tcb->rtx_deadline = 0; // disable rtx timer
-    tcb->rtx_rto = 0;
+    RtxClear(tcb); // drop unacked queue, disable rtx timer
 }
 
 // Frees a TCB slot back to the global pool.
@@ -847,6 +989,11 @@ static void FreeTcb(Tcb* tcb) {
     assert(tcb != nullptr);
 
     RtxClear(tcb);
+
+    while (!tcb->tx_queue.IsEmpty()) {
+        tcb->tx_queue.Pop();
+    }
+
     std::memset(tcb, 0, sizeof(*tcb));
     tcb->state = kStateClosed; // keep this in case CLOSED != 0
 }
@@ -1243,7 +1390,7 @@ __attribute__((hot)) void Input(struct Header* eth_frame) {
                         auto bytes_ack = SEG_ACK - tcb->SND.UNA;
                         tcb->SND.UNA = SEG_ACK;
 
-                        RtxOnAck(tcb, SEG_ACK); // Retransmission ACK handling
+                        RtxOnAck(tcb, SEG_ACK); // Retransmission ACK handling, RTT sample
 
                         if (SEG_ACK == tcb->SND.NXT) {
                             TCP_DEBUG_PUTS("All segments are acknowledged");
@@ -1273,6 +1420,15 @@ __attribute__((hot)) void Input(struct Header* eth_frame) {
                         }
                     } else if (Leq(SEG_ACK, tcb->SND.UNA)) { // RFC 1122 section 4.2.2.20 (g)
                         TCP_DEBUG_PUTS("Ignore duplicate ACK");
+                        // RFC 5681 2: a duplicate ACK carries no data and no window change, with data outstanding
+                        if ((SEG_ACK == tcb->SND.UNA) && (SEG_LEN == 0) && (SEG_WND == tcb->SND.WND) && (tcb->rtx.count > 0) && !(eth_frame->tcp.control & (Control::SYN | Control::FIN))) {
+                            globals::counter.duplicate_ack++;
+
+                            if (++tcb->dupacks == kTcpDupAckThreshold) {
+                                RtxSendHead(tcb);
+                                globals::counter.fast_retransmit++;
+                            }
+                        }
                         if (BetweenLh(tcb->SND.UNA, SEG_ACK, tcb->SND.NXT)) {
                             // ... but update send window
                             if (Lt(tcb->SND.WL1, SEG_SEQ) || (tcb->SND.WL1 == SEG_SEQ && Leq(tcb->SND.WL2, SEG_ACK))) {
@@ -1650,45 +1806,43 @@ int32_t Send(ConnHandle conn_handle, const uint8_t* buffer, uint32_t length) {
 
     TCP_DEBUG_PRINTF("%u -> %u", static_cast<unsigned>(conn_handle), static_cast<unsigned>(length));
 
-    const auto* p = buffer;
-
-    // Legacy behavior preserved:
-    // Only send if the FULL remaining length fits inside SND.WND.
-    // NOTE: Many stacks instead send min(length, wnd)
-    while ((length > 0) && (length <= tcb->SND.WND)) {
-        const uint32_t kWriteLen = (length > kTcpDataMss) ? kTcpDataMss : length;
-        const bool kIsLast = (length < kTcpDataMss);
-
-        SendData(tcb, p, kWriteLen, kIsLast);
-
-        p += kWriteLen;
-        length -= kWriteLen;
+    if (tcb->tx_pending.length != 0 && tcb->tx_queue.IsEmpty()) {
+        const auto kSent = SendBuffer(tcb, tcb->tx_pending.data, tcb->tx_pending.length);
+        tcb->tx_pending.data += kSent;
+        tcb->tx_pending.length -= kSent;
     }
 
-    if (length == 0) {
+    if (tcb->tx_pending.length != 0) {
+        // Still sending earlier data from the caller's buffer, nothing is accepted.
         TCP_DEBUG_EXIT();
-        return 0; // everything sent immediately
+        return -2;
     }
 
+    const auto* p = buffer;
     auto& queue = tcb->tx_queue;
 
-    if (!queue.IsEmpty()) {
-        // Already queued something.
-        TCP_DEBUG_EXIT();
-        return -2;
-    }
+    // Queued data goes first, new data is appended to it.
+    if (queue.IsEmpty()) {
+        const auto kSent = SendBuffer(tcb, p, length);
+        p += kSent;
+        length -= kSent;
 
-    while (length > 0) {
-        if (queue.IsFull()) {
-            // Can't queue everything.
+        if (length == 0) {
             TCP_DEBUG_EXIT();
-            return -2;
+            return 0; // everything sent immediately
         }
+    }
 
+    while (length > 0) {
         const uint32_t kWriteLen = (length > kTcpDataMss) ? kTcpDataMss : length;
         const bool kIsLast = (length < kTcpDataMss);
 
-        queue.Push(p, kWriteLen, kIsLast);
+        if (!queue.Push(p, kWriteLen, kIsLast)) {
+            // Out of memory, the remainder is sent from the caller's buffer.
+            tcb->tx_pending.data = p;
+            tcb->tx_pending.length = length;
+            break;
+        }
 
         p += kWriteLen;
         length -= kWriteLen;
@@ -39,6 +39,7 @@
 #include "core/protocol/ieee.h"
 #include "core/protocol/udp.h"
 #include "core/ip4/arp.h"
+#include "core/ip4/fragment.h"
 #include "network_udp.h"
 #include "network_private.h"
 #include "network_memcpy.h"
@@ -82,11 +83,79 @@ struct Port {
     Data data ALIGNED;
 } ALIGNED;
 
+/*
+ * Open addressing hash table (linear probing) port -> index in s_ports.
+ * The table is at least twice the number of ports, so a lookup is
+ * almost always resolved with the first probe.
+ */
+static constexpr uint32_t kHashBits = (32U - static_cast<uint32_t>(__builtin_clz(UDP_MAX_PORTS_ALLOWED))) + 1U;
+static constexpr uint32_t kHashSize = 1U << kHashBits;
+static constexpr uint32_t kHashMask = kHashSize - 1U;
+static constexpr uint8_t kHashEmpty = 0xFF;
+
+static_assert(kHashSize >= (2 * UDP_MAX_PORTS_ALLOWED));
+static_assert(UDP_MAX_PORTS_ALLOWED < kHashEmpty);
+
 static Port s_ports[UDP_MAX_PORTS_ALLOWED] SECTION_NETWORK ALIGNED;
+static uint8_t s_port_hash[kHashSize] SECTION_NETWORK ALIGNED;
 static uint16_t s_id SECTION_NETWORK ALIGNED;
 static uint8_t s_multicast_mac[network::ethernet::kAddressLength] SECTION_NETWORK ALIGNED;
 
+static constexpr uint32_t Hash(uint16_t port) {
+    return (static_cast<uint32_t>(port) * 0x9E3779B1U) >> (32U - kHashBits);
+}
+
+static int32_t Find(uint16_t port, uint32_t& slot) {
+    slot = Hash(port);
+
+    while (s_port_hash[slot] != kHashEmpty) {
+        const auto kIndex = s_port_hash[slot];
+
+        if (s_ports[kIndex].info.port == port) {
+            return kIndex;
+        }
+
+        slot = (slot + 1) & kHashMask;
+    }
+
+    return -1;
+}
+
+// Backward shift deletion, no tombstones are needed.
+static void HashRemove(uint32_t slot) {
+    auto hole = slot;
+    auto next = (slot + 1) & kHashMask;
+
+    while (s_port_hash[next] != kHashEmpty) {
+        const auto kHome = Hash(s_ports[s_port_hash[next]].info.port);
+
+        if (((next - kHome) & kHashMask) >= ((next - hole) & kHashMask)) {
+            s_port_hash[hole] = s_port_hash[next];
+            hole = next;
+        }
+
+        next = (next + 1) & kHashMask;
+    }
+
+    s_port_hash[hole] = kHashEmpty;
+}
+
+#if !defined(CHECKSUM_BY_HARDWARE) && defined(CONFIG_NET_UDP_CHECKSUM)
+/*
+ * Without checksum offload the UDP checksum is optional (RFC 768).
+ * With CONFIG_NET_UDP_CHECKSUM it is generated on transmit and
+ * validated on receive, when the sender has filled it in.
+ */
+static uint32_t ChecksumAdd(uint32_t source_ip, uint32_t destination_ip, const struct Packet* packet, uint32_t length) {
+    const uint32_t kPseudo[3] = {source_ip, destination_ip, __builtin_bswap32((static_cast<uint32_t>(network::ip4::Proto::kUdp) << 16) | length)};
+    const auto kSum = network::ChksumAdd(kPseudo, sizeof(kPseudo));
+    return network::ChksumAdd(packet, length, kSum);
+}
+#endif
+
 void __attribute__((cold)) Init() {
+    std::memset(s_port_hash, kHashEmpty, sizeof(s_port_hash));
+
     // Multicast fixed part
     s_multicast_mac[0] = network::ethernet::kIP4MulticastAddr0;
     s_multicast_mac[1] = network::ethernet::kIP4MulticastAddr1;
@@ -99,40 +168,184 @@ void __attribute__((cold)) Shutdown() {
     UDP_DEBUG_EXIT();
 }
 
-__attribute__((hot)) void Input(const struct Header* udp) {
+/*
+ * Ports with a callback borrow the payload straight from the EMAC receive buffer.
+ * The buffer is only valid during the callback, the descriptor is handed back
+ * to the DMA with emac::eth::FreePkt() as soon as the callback returns.
+ * Ports without a callback are polled with Recv(), so the payload is copied.
+ *
+ * A reassembled datagram is not in an EMAC receive buffer. It is handed to the
+ * callback at its full length, the polled ports get the first kDataSize bytes.
+ */
+template <bool kIsReassembled> static void InputImplementation(const struct Header* udp) {
     const auto kDestinationPort = __builtin_bswap16(udp->udp.destination_port);
 
-    for (uint32_t port_index = 0; port_index < UDP_MAX_PORTS_ALLOWED; port_index++) {
-        const auto& info = s_ports[port_index].info;
+    uint32_t slot;
+    const auto kPortIndex = Find(kDestinationPort, slot);
 
-        if (info.port == kDestinationPort) {
-            auto& data = s_ports[port_index].data;
+    if (__builtin_expect((kPortIndex < 0), 0)) {
+        if constexpr (!kIsReassembled) {
+            emac::eth::FreePkt();
+        }
+        UDP_DEBUG_PRINTF(IPSTR ":%d[%x] " MACSTR, udp->ip4.src[0], udp->ip4.src[1], udp->ip4.src[2], udp->ip4.src[3], kDestinationPort, kDestinationPort, MAC2STR(udp->ether.dst));
+        return;
+    }
 
-            if (__builtin_expect((data.size != 0), 0)) {
-                UDP_DEBUG_PRINTF("%d[%x]", kDestinationPort, kDestinationPort);
+#if !defined(CHECKSUM_BY_HARDWARE) && defined(CONFIG_NET_UDP_CHECKSUM)
+    // A reassembled datagram has already been verified by ip4::fragment
+    if constexpr (!kIsReassembled) {
+        if (udp->udp.checksum != 0) {
+            if (ChecksumAdd(network::MemcpyIp(udp->ip4.src), network::MemcpyIp(udp->ip4.dst), &udp->udp, __builtin_bswap16(udp->udp.len)) != 0xFFFF) {
+                emac::eth::FreePkt();
+                UDP_DEBUG_PUTS("Checksum error");
+                return;
             }
+        }
+    }
+#endif
 
-            const auto kDataLength = __builtin_bswap16(udp->udp.len) - kHeaderSize;
-            const auto kSize = std::min(kDataSize, kDataLength);
-
-            std::memcpy(data.data, udp->udp.data, kSize);
-            data.from_ip = network::MemcpyIp(udp->ip4.src);
-            data.from_port = __builtin_bswap16(udp->udp.source_port);
-            data.size = kSize;
+    const auto& info = s_ports[kPortIndex].info;
+    const auto kDataLength = __builtin_bswap16(udp->udp.len) - kHeaderSize;
+    const auto kSize = std::min(kDataSize, kDataLength);
+    const auto kFromIp = network::MemcpyIp(udp->ip4.src);
+    const auto kFromPort = __builtin_bswap16(udp->udp.source_port);
 
+    if (__builtin_expect((info.callback != nullptr), 1)) {
+        if constexpr (kIsReassembled) {
+            info.callback(udp->udp.data, kDataLength, kFromIp, kFromPort);
+        } else {
+            info.callback(udp->udp.data, kSize, kFromIp, kFromPort);
             emac::eth::FreePkt();
+        }
+        return;
+    }
 
-            if (info.callback != nullptr) {
-                info.callback(data.data, kSize, data.from_ip, data.from_port);
-            }
+    auto& data = s_ports[kPortIndex].data;
 
-            return;
-        }
+    if (__builtin_expect((data.size != 0), 0)) {
+        UDP_DEBUG_PRINTF("%d[%x]", kDestinationPort, kDestinationPort);
     }
 
-    emac::eth::FreePkt();
+    std::memcpy(data.data, udp->udp.data, kSize);
+    data.from_ip = kFromIp;
+    data.from_port = kFromPort;
+    data.size = kSize;
 
-    UDP_DEBUG_PRINTF(IPSTR ":%d[%x] " MACSTR, udp->ip4.src[0], udp->ip4.src[1], udp->ip4.src[2], udp->ip4.src[3], kDestinationPort, kDestinationPort, MAC2STR(udp->ether.dst));
+    if constexpr (!kIsReassembled) {
+        emac::eth::FreePkt();
+    }
+}
+
+__attribute__((hot)) void Input(const struct Header* udp) {
+    InputImplementation<false>(udp);
+}
+
+void InputReassembled(const struct Header* udp) {
+    InputImplementation<true>(udp);
+}
+
+/*
+ * Sets the destination of a broadcast or multicast datagram, for which the
+ * MAC address is known. Returns false for a unicast destination, which is
+ * left to ARP.
+ */
+static bool SetDestination(Header* out_buffer, uint32_t remote_ip) {
+    if (remote_ip == network::kIpaddrBroadcast) {
+        network::Memset<0xFF, network::ethernet::kAddressLength>(out_buffer->ether.dst);
+        network::Memset<0xFF, network::ethernet::kAddressLength>(out_buffer->ip4.dst);
+        return true;
+    }
+
+    if ((remote_ip & network::global::broadcast_mask) == network::global::broadcast_mask) {
+        network::Memset<0xFF, network::ethernet::kAddressLength>(out_buffer->ether.dst);
+        network::MemcpyIp(out_buffer->ip4.dst, remote_ip);
+        return true;
+    }
+
+    if ((remote_ip & 0xF0) == 0xE0) { // Multicast, we know the MAC Address
+        using _pcast32 = union pcast32 {
+            uint32_t u32;
+            uint8_t u8[4];
+        };
+        _pcast32 multicast_ip;
+
+        multicast_ip.u32 = remote_ip;
+        s_multicast_mac[3] = multicast_ip.u8[1] & 0x7F;
+        s_multicast_mac[4] = multicast_ip.u8[2];
+        s_multicast_mac[5] = multicast_ip.u8[3];
+
+        std::memcpy(out_buffer->ether.dst, s_multicast_mac, network::ethernet::kAddressLength);
+        network::MemcpyIp(out_buffer->ip4.dst, remote_ip);
+        return true;
+    }
+
+    return false;
+}
+
+/*
+ * A datagram larger than kDataSize is sent as IPv4 fragments (RFC 791), all
+ * with the same identification. Each fragment carries a multiple of 8 bytes,
+ * except the last one, and the first one starts with the UDP header.
+ * The checksum offload engine cannot checksum the payload of a fragment,
+ * so the UDP checksum is not used (RFC 768).
+ */
+static void SendFragmented(int index, const uint8_t* data, uint32_t size, uint32_t remote_ip, uint16_t remote_port) {
+    static constexpr uint32_t kFragmentSize = (network::ethernet::kMtuSize - network::ip4::kHeaderSize) & ~7U;
+    const auto kLength = size + kHeaderSize;
+
+    if (__builtin_expect((kLength > (UINT16_MAX - network::ip4::kHeaderSize)), 0)) {
+        ERROR("Datagram too large");
+        return;
+    }
+
+    const auto kId = ++s_id;
+    uint32_t offset = 0;
+
+    while (offset < kLength) {
+        auto* out_buffer = reinterpret_cast<Header*>(emac::eth::SendGetDmaBuffer());
+        const auto kFragment = std::min(kFragmentSize, kLength - offset);
+        const auto kFlags = ((offset + kFragment) < kLength) ? network::ip4::Flags::kFlagMf : network::ip4::Flags::kFlagLf;
+
+        // Ethernet
+        std::memcpy(out_buffer->ether.src, netif::global::netif_default.hwaddr, network::ethernet::kAddressLength);
+        out_buffer->ether.type = __builtin_bswap16(network::ethernet::Type::kIPv4);
+
+        // IPv4
+        out_buffer->ip4.ver_ihl = 0x45;
+        out_buffer->ip4.tos = 0;
+        out_buffer->ip4.flags_froff = __builtin_bswap16(static_cast<uint16_t>(kFlags | (offset >> 3)));
+        out_buffer->ip4.ttl = 64;
+        out_buffer->ip4.proto = network::ip4::Proto::kUdp;
+        out_buffer->ip4.id = kId;
+        out_buffer->ip4.len = __builtin_bswap16(static_cast<uint16_t>(kFragment + network::ip4::kHeaderSize));
+        out_buffer->ip4.chksum = 0;
+        network::MemcpyIp(out_buffer->ip4.src, netif::global::netif_default.ip.addr);
+
+        if (offset == 0) {
+            // UDP
+            out_buffer->udp.source_port = __builtin_bswap16(s_ports[index].info.port);
+            out_buffer->udp.destination_port = __builtin_bswap16(remote_port);
+            out_buffer->udp.len = __builtin_bswap16(static_cast<uint16_t>(kLength));
+            out_buffer->udp.checksum = 0;
+            std::memcpy(out_buffer->udp.data, data, kFragment - kHeaderSize);
+        } else {
+            std::memcpy(&out_buffer->udp, &data[offset - kHeaderSize], kFragment);
+        }
+
+        const auto kFrameLength = kFragment + sizeof(struct network::ethernet::Header) + network::ip4::kHeaderSize;
+
+        if (SetDestination(out_buffer, remote_ip)) {
+#if !defined(CHECKSUM_BY_HARDWARE)
+            out_buffer->ip4.chksum = network::Chksum(reinterpret_cast<void*>(&out_buffer->ip4), sizeof(out_buffer->ip4));
+#endif
+            emac::eth::SendFragment(kFrameLength);
+        } else {
+            network::arp::SendFragment(out_buffer, kFrameLength, remote_ip);
+        }
+
+        network::ip4::fragment::globals::counter.sent++;
+        offset += kFragment;
+    }
 }
 
 template <network::arp::EthSend S> static void SendImplementation(int index, const uint8_t* data, uint32_t size, uint32_t remote_ip, uint16_t remote_port) {
@@ -140,6 +353,16 @@ template <network::arp::EthSend S> static void SendImplementation(int index, con
     assert(index < UDP_MAX_PORTS_ALLOWED);
     assert(s_ports[index].info.port != 0);
 
+    if constexpr (S == network::arp::EthSend::kIsNormal) {
+        // With SendBuffer() the payload is already in the DMA buffer, it cannot be fragmented
+        if (__builtin_expect(((size > kDataSize) && (data != nullptr)), 0)) {
+            SendFragmented(index, data, size, remote_ip, remote_port);
+            return;
+        }
+    }
+
+    size = std::min(kDataSize, size);
+
     auto* out_buffer = reinterpret_cast<Header*>(emac::eth::SendGetDmaBuffer());
 
     // Ethernet
@@ -163,42 +386,27 @@ template <network::arp::EthSend S> static void SendImplementation(int index, con
     out_buffer->udp.len = __builtin_bswap16(static_cast<uint16_t>(size + kHeaderSize));
     out_buffer->udp.checksum = 0;
 
-    size = std::min(kDataSize, size);
+    // With SendBuffer() the payload is already in the DMA buffer
+    if (data != nullptr) {
+        std::memcpy(out_buffer->udp.data, data, size);
+    }
 
-    std::memcpy(out_buffer->udp.data, data, size);
+#if !defined(CHECKSUM_BY_HARDWARE) && defined(CONFIG_NET_UDP_CHECKSUM)
+    // For a limited broadcast the destination is 255.255.255.255, which is remote_ip
+    const auto kChecksum = static_cast<uint16_t>(~ChecksumAdd(netif::global::netif_default.ip.addr, remote_ip, &out_buffer->udp, __builtin_bswap16(out_buffer->udp.len)));
+    out_buffer->udp.checksum = (kChecksum == 0) ? 0xFFFF : kChecksum;
+#endif
 
-    if (remote_ip == network::kIpaddrBroadcast) {
-        network::Memset<0xFF, network::ethernet::kAddressLength>(out_buffer->ether.dst);
-        network::Memset<0xFF, network::ethernet::kAddressLength>(out_buffer->ip4.dst);
-    } else if ((remote_ip & network::global::broadcast_mask) == network::global::broadcast_mask) {
-        network::Memset<0xFF, network::ethernet::kAddressLength>(out_buffer->ether.dst);
-        network::MemcpyIp(out_buffer->ip4.dst, remote_ip);
-    } else {
-        if ((remote_ip & 0xF0) == 0xE0) { // Multicast, we know the MAC Address
-            using _pcast32 = union pcast32 {
-                uint32_t u32;
-                uint8_t u8[4];
-            };
-            _pcast32 multicast_ip;
-
-            multicast_ip.u32 = remote_ip;
-            s_multicast_mac[3] = multicast_ip.u8[1] & 0x7F;
-            s_multicast_mac[4] = multicast_ip.u8[2];
-            s_multicast_mac[5] = multicast_ip.u8[3];
-
-            std::memcpy(out_buffer->ether.dst, s_multicast_mac, network::ethernet::kAddressLength);
-            network::MemcpyIp(out_buffer->ip4.dst, remote_ip);
-        } else {
-            if constexpr (S == network::arp::EthSend::kIsNormal) {
-                network::arp::Send(out_buffer, size + kUdpPacketHeadersSize, remote_ip);
-            }
+    if (!SetDestination(out_buffer, remote_ip)) {
+        if constexpr (S == network::arp::EthSend::kIsNormal) {
+            network::arp::Send(out_buffer, size + kUdpPacketHeadersSize, remote_ip);
+        }
 #if defined CONFIG_NET_ENABLE_PTP
-            else if constexpr (S == network::arp::EthSend::kIsTimestamp) {
-                network::arp::SendTimestamp(out_buffer, size + kUdpPacketHeadersSize, remote_ip);
-            }
-#endif
-            return;
+        else if constexpr (S == network::arp::EthSend::kIsTimestamp) {
+            network::arp::SendTimestamp(out_buffer, size + kUdpPacketHeadersSize, remote_ip);
         }
+#endif
+        return;
     }
 
 #if !defined(CHECKSUM_BY_HARDWARE)
@@ -218,17 +426,23 @@ template <network::arp::EthSend S> static void SendImplementation(int index, con
 int32_t Begin(uint16_t localport, UdpCallbackFunctionPtr callback) {
     UDP_DEBUG_PRINTF("localport=%u", static_cast<unsigned>(localport));
 
+    uint32_t slot;
+    const auto kPortIndex = Find(localport, slot);
+
+    if (kPortIndex >= 0) {
+        return kPortIndex;
+    }
+
     for (auto i = 0; i < UDP_MAX_PORTS_ALLOWED; i++) {
         auto& info = s_ports[i].info;
 
-        if (info.port == localport) {
-            return i;
-        }
-
         if (info.port == 0) {
             info.callback = callback;
             info.port = localport;
 
+            // Find() has returned the first free slot of the probe sequence
+            s_port_hash[slot] = static_cast<uint8_t>(i);
+
             UDP_DEBUG_PRINTF("i=%d, localport=%d[%x], callback=%p", static_cast<int>(i), static_cast<unsigned>(localport), static_cast<unsigned>(localport), reinterpret_cast<void*>(callback));
             return i;
         }
@@ -241,27 +455,38 @@ int32_t Begin(uint16_t localport, UdpCallbackFunctionPtr callback) {
 int32_t End(uint16_t localport) {
     UDP_DEBUG_PRINTF("localport=%u[%x]", static_cast<unsigned>(localport), static_cast<unsigned>(localport));
 
-    for (auto i = 0; i < UDP_MAX_PORTS_ALLOWED; i++) {
-        auto& info = s_ports[i].info;
-
-        if (info.port == localport) {
-            info.callback = nullptr;
-            info.port = 0;
+    uint32_t slot;
+    const auto kPortIndex = Find(localport, slot);
 
-            auto& data = s_ports[i].data;
-            data.size = 0;
-            return 0;
-        }
+    if (kPortIndex < 0) {
+        ERROR("Port not found.");
+        return -1;
     }
 
-    ERROR("Port not found.");
-    return -1;
+    HashRemove(slot);
+
+    auto& info = s_ports[kPortIndex].info;
+    info.callback = nullptr;
+    info.port = 0;
+
+    auto& data = s_ports[kPortIndex].data;
+    data.size = 0;
+
+    return 0;
 }
 
 void Send(int32_t index, const uint8_t* data, uint32_t size, uint32_t remote_ip, uint16_t remote_port) {
     SendImplementation<network::arp::EthSend::kIsNormal>(index, data, size, remote_ip, remote_port);
 }
 
+uint8_t* GetSendBuffer() {
+    return reinterpret_cast<Header*>(emac::eth::SendGetDmaBuffer())->udp.data;
+}
+
+void SendBuffer(int32_t index, uint32_t size, uint32_t remote_ip, uint16_t remote_port) {
+    SendImplementation<network::arp::EthSend::kIsNormal>(index, nullptr, size, remote_ip, remote_port);
+}
+
 #if defined CONFIG_NET_ENABLE_PTP
 void SendWithTimestamp(int32_t index, const uint8_t* data, uint32_t size, uint32_t remote_ip, uint16_t remote_port) {
     SendImplementation<network::arp::EthSend::kIsTimestamp>(index, data, size, remote_ip, remote_port);
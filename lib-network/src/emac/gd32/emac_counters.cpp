@@ -27,6 +27,11 @@
 
 #include "network_iface.h"
 #include "emac_counters.h"
+#include "core/ip4/arp.h"
+#include "core/ip4/fragment.h"
+#include "core/ip4/igmp.h"
+#include "../src/core/network_memory.h"
+#include "network_tcp.h"
 #include "gd32.h" // IWYU pragma: keep
 
 namespace network::iface {
@@ -69,5 +74,59 @@ void GetCounters(Counters& counters) {
     counters.tx.drp = emac::eth::globals::counter.send_busy;
     counters.tx.err = 0;
     counters.tx.ovr = 0;
+
+    // Tx descriptor ring
+    counters.txq.hwm = emac::eth::globals::counter.send_queue_max;
+    counters.txq.busy_cycles = emac::eth::globals::counter.send_busy_cycles;
+    counters.txq.busy_max = emac::eth::globals::counter.send_busy_max;
+
+    // Rx descriptor ring, drained by network::Run
+    counters.rxq.ovr = emac::eth::globals::counter.rx_overflow;
+    counters.rxq.hwm = emac::eth::globals::counter.rx_pending_max;
+    counters.rxq.batch = emac::eth::globals::counter.rx_batch;
+    counters.rxq.batch_max = emac::eth::globals::counter.rx_batch_max;
+
+    // IPv4 fragmentation and reassembly
+    const auto& fragment = network::ip4::fragment::globals::counter;
+    counters.frag.rx = fragment.received;
+    counters.frag.tx = fragment.sent;
+    counters.frag.ok = fragment.reassembled;
+    counters.frag.tmo = fragment.timeout;
+    counters.frag.drp = fragment.dropped;
+    counters.frag.busy = fragment.busy;
+    counters.frag.latency_max = fragment.latency_max;
+    counters.frag.mem_hwm = fragment.memory_max;
+
+    // IGMP software filter, behind the EMAC multicast hash filter
+    const auto& igmp = network::igmp::globals::counter;
+    counters.mc.ok = igmp.accepted;
+    counters.mc.drp_hash = igmp.rejected_hash;
+    counters.mc.drp_alias = igmp.rejected_alias;
+    counters.mc.probe_max = igmp.probes_max;
+
+    // ARP cache and pending queue
+    const auto& arp = network::arp::globals::counter;
+    counters.arp.hit = arp.hit;
+    counters.arp.miss = arp.miss;
+    counters.arp.queued = arp.queued;
+    counters.arp.drp = arp.dropped;
+    counters.arp.refresh = arp.refresh;
+    counters.arp.learned = arp.learned;
+    counters.arp.stall_max = arp.stall_max;
+
+    // network::memory size classes
+    network::memory::Counters memory;
+    network::memory::Allocator::Instance().GetCounters(memory);
+    counters.mem.hwm = memory.blocks_max;
+    counters.mem.fail = memory.blocks_fail;
+    counters.mem.small_hwm = memory.small_max;
+    counters.mem.small_fail = memory.small_fail;
+
+    // TCP retransmission
+    const auto& tcp = network::tcp::globals::counter;
+    counters.tcp.rtx = tcp.retransmit;
+    counters.tcp.fast_rtx = tcp.fast_retransmit;
+    counters.tcp.dupack = tcp.duplicate_ack;
+    counters.tcp.srtt_max = tcp.srtt_max;
 }
 } // namespace network::iface
@@ -11,8 +11,15 @@
 namespace emac::eth::globals {
 struct Counters {
     uint32_t sent;
-    uint32_t send_busy;
+    uint32_t send_busy;          ///< Transmit had to wait for a free Tx descriptor
+    uint32_t send_busy_cycles;   ///< Total CPU cycles spent waiting for a free Tx descriptor
+    uint32_t send_busy_max;      ///< Longest single wait in CPU cycles
+    uint32_t send_queue_max;     ///< High-water mark of frames queued in the Tx descriptor ring
     uint32_t received;
+    uint32_t rx_overflow;    ///< Rx descriptor ring was full (RBU), frames are lost
+    uint32_t rx_pending_max; ///< High-water mark of received frames waiting in the ring
+    uint32_t rx_batch;       ///< Frames handled by the last drain in network::Run
+    uint32_t rx_batch_max;   ///< Largest drain in network::Run
 };
 extern struct Counters counter;
 } // namespace emac::eth::globals
@@ -56,8 +56,12 @@ extern uint32_t timestamp[2];
 } // namespace net::globals::ptp
 #endif
 
+/// Receive descriptor ring, chained in array order
+extern enet_descriptors_struct rxdesc_tab[ENET_RXBUF_NUM];
 /// Current receive descriptor
 extern enet_descriptors_struct* dma_current_rxdesc;
+/// Transmit descriptor ring, chained in array order
+extern enet_descriptors_struct txdesc_tab[ENET_TXBUF_NUM];
 /// Current transmit descriptor
 extern enet_descriptors_struct* dma_current_txdesc;
 
@@ -83,6 +87,43 @@ uint32_t Recv(uint8_t** packet) {
     return 0;
 }
 
+/**
+ * @brief Updates the drain statistics, called by network::Run after a batch.
+ *
+ * The frames still owned by the CPU are counted by walking the ring in array
+ * order, as with PTP the descriptor next pointer holds the timestamp.
+ *
+ * @param batch Number of frames handled in this drain.
+ */
+void RecvBatch(uint32_t batch) {
+    auto index = static_cast<uint32_t>(dma_current_rxdesc - rxdesc_tab);
+    auto pending = batch;
+
+    for (uint32_t i = 0; i < ENET_RXBUF_NUM; i++) {
+        if (0 != (rxdesc_tab[index].status & ENET_RDES0_DAV)) {
+            break;
+        }
+
+        pending++;
+
+        if (++index == ENET_RXBUF_NUM) {
+            index = 0;
+        }
+    }
+
+    auto& counter = emac::eth::globals::counter;
+
+    counter.rx_batch = batch;
+
+    if (batch > counter.rx_batch_max) {
+        counter.rx_batch_max = batch;
+    }
+
+    if (pending > counter.rx_pending_max) {
+        counter.rx_pending_max = pending;
+    }
+}
+
 #if defined(CONFIG_NET_ENABLE_PTP)
 // Handles reception of a PTP frame in normal mode.
 static void PtpFrameReceiveNormalMode() {
@@ -97,7 +138,9 @@ static void PtpFrameReceiveNormalMode() {
     __DMB();
 #endif
 
-    gd32::enet::HandleRxBufferUnavailable();
+    if (gd32::enet::HandleRxBufferUnavailable()) {
+        emac::eth::globals::counter.rx_overflow++;
+    }
 
     assert(0 != (dma_current_rxdesc->control_buffer_size & ENET_RDES1_RCHM)); /// chained mode
 
@@ -119,7 +162,9 @@ static void PtpFrameReceiveNormalMode() {
 static void FrameReceive() {
     dma_current_rxdesc->status = ENET_RDES0_DAV;
 
-    gd32::enet::HandleRxBufferUnavailable();
+    if (gd32::enet::HandleRxBufferUnavailable()) {
+        emac::eth::globals::counter.rx_overflow++;
+    }
 
     assert(0 != (dma_current_rxdesc->control_buffer_size & ENET_RDES1_RCHM));
 
@@ -143,6 +188,21 @@ void FreePkt() {
 #endif
 }
 
+/**
+ * @brief Checks, without waiting on the descriptor, whether a frame was built
+ * in the buffer returned by SendGetDmaBuffer().
+ *
+ * @param buffer Pointer to the frame.
+ * @return true when the frame is in the current Tx DMA buffer.
+ */
+bool IsSendDmaBuffer(const void* buffer) {
+#if defined(CONFIG_NET_ENABLE_PTP)
+    return reinterpret_cast<uintptr_t>(buffer) == dma_current_ptp_txdesc->buffer1_addr;
+#else
+    return reinterpret_cast<uintptr_t>(buffer) == dma_current_txdesc->buffer1_addr;
+#endif
+}
+
 #if defined(CONFIG_NET_ENABLE_PTP)
 /**
  * @brief Retrieves the DMA buffer for Ethernet transmission with PTP.
@@ -235,7 +295,28 @@ void Send(uint32_t length) {
     assert(length <= ENET_MAX_FRAME_SIZE);
 
     auto status = dma_current_txdesc->status;
-    status &= ~ENET_TDES0_TTSEN;
+    status &= ~(ENET_TDES0_TTSEN | ENET_TDES0_CM);
+    status |= ENET_CHECKSUM_TCPUDPICMP_FULL;
+    dma_current_txdesc->status = status;
+
+#if defined(GD32H7XX)
+    __DMB();
+#endif
+
+    PtpFrameTransmit<false>(length);
+}
+
+/**
+ * @brief Transmits an IPv4 fragment, only the IP header checksum is inserted.
+ *
+ * @param length Length of the frame to transmit.
+ */
+void SendFragment(uint32_t length) {
+    assert(length <= ENET_MAX_FRAME_SIZE);
+
+    auto status = dma_current_txdesc->status;
+    status &= ~(ENET_TDES0_TTSEN | ENET_TDES0_CM);
+    status |= ENET_CHECKSUM_IPV4HEADER;
     dma_current_txdesc->status = status;
 
 #if defined(GD32H7XX)
@@ -260,7 +341,8 @@ void Send(void* buffer, const uint32_t length) {
     }
 
     auto status = dma_current_txdesc->status;
-    status &= ~ENET_TDES0_TTSEN; // Disable timestamping
+    status &= ~(ENET_TDES0_TTSEN | ENET_TDES0_CM); // Disable timestamping
+    status |= ENET_CHECKSUM_TCPUDPICMP_FULL;
     dma_current_txdesc->status = status;
 
 #if defined(GD32H7XX)
@@ -279,7 +361,9 @@ void SendTimestamp(uint32_t length) {
     assert(length <= ENET_MAX_FRAME_SIZE);
 
     auto status = dma_current_txdesc->status;
+    status &= ~ENET_TDES0_CM;
     status |= ENET_TDES0_TTSEN; ///< Enable timestamping
+    status |= ENET_CHECKSUM_TCPUDPICMP_FULL;
     dma_current_txdesc->status = status;
 
 #if defined(GD32H7XX)
@@ -304,7 +388,9 @@ void SendTimestamp(void* buffer, uint32_t length) {
     }
 
     auto status = dma_current_txdesc->status;
+    status &= ~ENET_TDES0_CM;
     status |= ENET_TDES0_TTSEN; // Enable timestamping
+    status |= ENET_CHECKSUM_TCPUDPICMP_FULL;
     dma_current_txdesc->status = status;
 
 #if defined(GD32H7XX)
@@ -314,6 +400,55 @@ void SendTimestamp(void* buffer, uint32_t length) {
     PtpFrameTransmit<true>(buffer, length);
 }
 #else
+/**
+ * @brief Waits for the DMA to release the current Tx descriptor.
+ *
+ * Only entered when all Tx descriptors are queued. The time spent
+ * waiting is accumulated in CPU cycles.
+ */
+static void __attribute__((noinline)) SendWaitDescriptor() {
+    auto& counter = emac::eth::globals::counter;
+    const auto kCyclesStart = DWT->CYCCNT;
+
+    counter.send_busy++;
+
+    while (0 != (dma_current_txdesc->status & ENET_TDES0_DAV)) {
+        __DMB(); ///< Wait until descriptor is available
+    }
+
+    const auto kCycles = DWT->CYCCNT - kCyclesStart;
+
+    counter.send_busy_cycles += kCycles;
+
+    if (kCycles > counter.send_busy_max) {
+        counter.send_busy_max = kCycles;
+    }
+}
+
+/**
+ * @brief Counts the frames queued for the DMA, including the one just handed over.
+ *
+ * The queued descriptors precede the current one in the ring.
+ */
+static void SendQueueUpdate() {
+    auto index = static_cast<uint32_t>(dma_current_txdesc - txdesc_tab);
+    uint32_t queued = 0;
+
+    while (queued < ENET_TXBUF_NUM) {
+        index = (index == 0) ? (ENET_TXBUF_NUM - 1) : (index - 1);
+
+        if (0 == (txdesc_tab[index].status & ENET_TDES0_DAV)) {
+            break;
+        }
+
+        queued++;
+    }
+
+    if (queued > emac::eth::globals::counter.send_queue_max) {
+        emac::eth::globals::counter.send_queue_max = queued;
+    }
+}
+
 /**
  * @brief Retrieves the DMA buffer for Ethernet transmission.
  *
@@ -321,23 +456,28 @@ void SendTimestamp(void* buffer, uint32_t length) {
  */
 uint8_t* SendGetDmaBuffer() {
     // The descriptor is busy due to own by the DMA
-    if (0 != (dma_current_txdesc->status & ENET_TDES0_DAV)) {
-        emac::eth::globals::counter.send_busy++;
-        while (0 != (dma_current_txdesc->status & ENET_TDES0_DAV)) {
-            __DMB(); ///< Wait until descriptor is available
-        }
+    if (__builtin_expect((0 != (dma_current_txdesc->status & ENET_TDES0_DAV)), 0)) {
+        SendWaitDescriptor();
     }
 
     return reinterpret_cast<uint8_t*>(dma_current_txdesc->buffer1_addr);
 }
 
-// Transmits an Ethernet frame.
-void Send(uint32_t length) {
+/**
+ * @brief Hands the current Tx descriptor over to the DMA.
+ *
+ * @param length Length of the frame to transmit.
+ * @param checksum Checksum insertion mode (TDES0 CM) for this frame.
+ */
+static void FrameTransmit(uint32_t length, uint32_t checksum) {
     debug::Dump(reinterpret_cast<uint8_t*>(dma_current_txdesc->buffer1_addr), length);
 
-    dma_current_txdesc->control_buffer_size = length;              ///< Set the frame length
-    dma_current_txdesc->status |= ENET_TDES0_LSG | ENET_TDES0_FSG; ///< Set the segment of frame, frame is transmitted in one descriptor
-    dma_current_txdesc->status |= ENET_TDES0_DAV;                  ///< Enable DMA transmission
+    auto status = dma_current_txdesc->status & ~ENET_TDES0_CM;
+    status |= checksum | ENET_TDES0_LSG | ENET_TDES0_FSG; ///< Set the segment of frame, frame is transmitted in one descriptor
+
+    dma_current_txdesc->control_buffer_size = length; ///< Set the frame length
+    dma_current_txdesc->status = status;
+    dma_current_txdesc->status |= ENET_TDES0_DAV; ///< Enable DMA transmission
 
 #if defined(GD32H7XX)
     __DMB();
@@ -350,9 +490,28 @@ void Send(uint32_t length) {
     /// Update the current TxDMA descriptor pointer to the next descriptor in TxDMA descriptor table
     dma_current_txdesc = reinterpret_cast<enet_descriptors_struct*>(dma_current_txdesc->buffer2_next_desc_addr);
 
+    SendQueueUpdate();
+
     emac::eth::globals::counter.sent++;
 }
 
+// Transmits an Ethernet frame.
+void Send(uint32_t length) {
+    FrameTransmit(length, ENET_CHECKSUM_TCPUDPICMP_FULL);
+}
+
+/**
+ * @brief Transmits an IPv4 fragment.
+ *
+ * Only the IP header checksum is inserted, as the payload checksum of a
+ * fragment cannot be calculated by the checksum offload engine.
+ *
+ * @param length Length of the frame to transmit.
+ */
+void SendFragment(uint32_t length) {
+    FrameTransmit(length, ENET_CHECKSUM_IPV4HEADER);
+}
+
 // Transmits an Ethernet frame with data copying.
 void Send(void* buffer, uint32_t length) {
     EMAC_DEBUG_PRINTF("%p -> %u", buffer, static_cast<unsigned>(length));
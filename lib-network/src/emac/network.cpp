@@ -152,6 +152,7 @@ void Init() {
     network::arp::Init();
 
     network::udp::Init();
+    network::ip4::fragment::Init();
     network::igmp::Init();
 #if defined(ENABLE_HTTPD)
     network::tcp::Init();
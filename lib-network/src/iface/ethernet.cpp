@@ -71,6 +71,12 @@ void EthernetInput(const uint8_t* buffer, [[maybe_unused]] uint32_t length) {
                 }
             }
 
+            if (__builtin_expect(((kIp4->ip4.flags_froff & __builtin_bswap16(ip4::Flags::kFlagMf | ip4::Flags::kOffsetMask)) != 0), 0)) {
+                network::ip4::fragment::Input(kIp4);
+                // NOTE: emac::eth::FreePkt() is done in network::ip4::fragment::Input
+                return;
+            }
+
             switch (kIp4->ip4.proto) {
                 case ip4::Proto::kUdp:
                     network::udp::Input(reinterpret_cast<const struct network::udp::Header*>(kIp4));
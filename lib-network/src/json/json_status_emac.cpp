@@ -73,6 +73,74 @@ uint32_t Emac(char* out_buffer, uint32_t out_buffer_size) {
     write_u32(counters.tx.drp);
     write_string(",\"tx_ovr\":");
     write_u32(counters.tx.ovr);
+    write_string(",\"rxq_ovr\":");
+    write_u32(counters.rxq.ovr);
+    write_string(",\"rxq_hwm\":");
+    write_u32(counters.rxq.hwm);
+    write_string(",\"rxq_batch\":");
+    write_u32(counters.rxq.batch);
+    write_string(",\"rxq_batch_max\":");
+    write_u32(counters.rxq.batch_max);
+    write_string(",\"txq_hwm\":");
+    write_u32(counters.txq.hwm);
+    write_string(",\"txq_busy_cycles\":");
+    write_u32(counters.txq.busy_cycles);
+    write_string(",\"txq_busy_max\":");
+    write_u32(counters.txq.busy_max);
+    write_string(",\"frag_rx\":");
+    write_u32(counters.frag.rx);
+    write_string(",\"frag_tx\":");
+    write_u32(counters.frag.tx);
+    write_string(",\"frag_ok\":");
+    write_u32(counters.frag.ok);
+    write_string(",\"frag_tmo\":");
+    write_u32(counters.frag.tmo);
+    write_string(",\"frag_drp\":");
+    write_u32(counters.frag.drp);
+    write_string(",\"frag_busy\":");
+    write_u32(counters.frag.busy);
+    write_string(",\"frag_latency_max\":");
+    write_u32(counters.frag.latency_max);
+    write_string(",\"frag_mem_hwm\":");
+    write_u32(counters.frag.mem_hwm);
+    write_string(",\"mc_ok\":");
+    write_u32(counters.mc.ok);
+    write_string(",\"mc_drp_hash\":");
+    write_u32(counters.mc.drp_hash);
+    write_string(",\"mc_drp_alias\":");
+    write_u32(counters.mc.drp_alias);
+    write_string(",\"mc_probe_max\":");
+    write_u32(counters.mc.probe_max);
+    write_string(",\"arp_hit\":");
+    write_u32(counters.arp.hit);
+    write_string(",\"arp_miss\":");
+    write_u32(counters.arp.miss);
+    write_string(",\"arp_queued\":");
+    write_u32(counters.arp.queued);
+    write_string(",\"arp_drp\":");
+    write_u32(counters.arp.drp);
+    write_string(",\"arp_refresh\":");
+    write_u32(counters.arp.refresh);
+    write_string(",\"arp_learned\":");
+    write_u32(counters.arp.learned);
+    write_string(",\"arp_stall_max\":");
+    write_u32(counters.arp.stall_max);
+    write_string(",\"mem_hwm\":");
+    write_u32(counters.mem.hwm);
+    write_string(",\"mem_fail\":");
+    write_u32(counters.mem.fail);
+    write_string(",\"mem_small_hwm\":");
+    write_u32(counters.mem.small_hwm);
+    write_string(",\"mem_small_fail\":");
+    write_u32(counters.mem.small_fail);
+    write_string(",\"tcp_rtx\":");
+    write_u32(counters.tcp.rtx);
+    write_string(",\"tcp_fast_rtx\":");
+    write_u32(counters.tcp.fast_rtx);
+    write_string(",\"tcp_dupack\":");
+    write_u32(counters.tcp.dupack);
+    write_string(",\"tcp_srtt_max\":");
+    write_u32(counters.tcp.srtt_max);
     write_string("}");
 
     return static_cast<uint32_t>(p - out_buffer);
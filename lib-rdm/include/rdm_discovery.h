@@ -43,13 +43,17 @@ void Starting(uint32_t port_index, Type type);
 void Finished(uint32_t port_index, Type type);
 } // namespace discovery
 
-class Discovery : rdm::discovery::StateMachine {
+class Discovery {
    public:
     static constexpr auto kPorts = dmx::config::max::kPorts;
 
-    Discovery() : rdm::discovery::StateMachine(rdm::device::Base::Instance().GetUID()) {
+    Discovery() {
         assert(s_this == nullptr);
         s_this = this;
+
+        for (uint32_t port_index = 0; port_index < kPorts; port_index++) {
+            state_machine_[port_index].Init(port_index, rdm::device::Base::Instance().GetUID());
+        }
     }
 
     ~Discovery() = default;
@@ -118,30 +122,19 @@ class Discovery : rdm::discovery::StateMachine {
     void Stop(uint32_t port_index) {
         assert(port_index < kPorts);
         if ((Bit(port_index) & enabled_) == Bit(port_index)) {
-            bool is_incremental;
-            uint32_t index;
-            if (rdm::discovery::StateMachine::IsRunning(index, is_incremental)) {
-                if (index == port_index) {
-                    rdm::discovery::StateMachine::Stop();
-                    waiting_ &= static_cast<uint8_t>(~Bit(port_index));
-                }
-            }
+            state_machine_[port_index].Stop();
+            waiting_ &= static_cast<uint8_t>(~Bit(port_index));
         }
     }
 
-    bool IsRunning(uint32_t portindex, bool& is_incremental) { return rdm::discovery::StateMachine::IsRunning(portindex, is_incremental); }
+    bool IsRunning(uint32_t port_index, bool& is_incremental) {
+        assert(port_index < kPorts);
+        return state_machine_[port_index].IsRunning(is_incremental);
+    }
 
     bool IsRunning(uint32_t port_index) {
         assert(port_index < kPorts);
-
-        uint32_t portindex;
-        bool is_incremental;
-
-        if (rdm::discovery::StateMachine::IsRunning(portindex, is_incremental)) {
-            return port_index == portindex;
-        }
-
-        return false;
+        return state_machine_[port_index].IsRunning();
     }
 
     void GetStatus(uint8_t data[5]) {
@@ -166,59 +159,72 @@ class Discovery : rdm::discovery::StateMachine {
 
     [[nodiscard]] uint8_t GetBackgroundIntervalMinutes() const { return background_interval_minutes_; }
 
-    uint32_t CopyWorkingQueue(char* out_buffer, uint32_t out_buffer_size) { return rdm::discovery::StateMachine::CopyWorkingQueue(out_buffer, out_buffer_size); }
+    uint32_t CopyWorkingQueue(char* out_buffer, uint32_t out_buffer_size) {
+        uint32_t length = 0;
 
-    void Run() {
-        rdm::discovery::StateMachine::Run();
+        for (uint32_t port_index = 0; port_index < kPorts; port_index++) {
+            const auto kLength = state_machine_[port_index].CopyWorkingQueue(&out_buffer[length], out_buffer_size - length);
 
-        if (__builtin_expect((!running_), 1)) {
-            return;
+            if ((kLength != 0) && ((length + kLength) < out_buffer_size)) {
+                length += kLength;
+                out_buffer[length++] = ',';
+            }
         }
 
-        if (rdm::discovery::StateMachine::IsRunning()) {
-            return;
+        if (length == 0) {
+            return 0;
         }
 
-        bool is_incremental;
+        out_buffer[--length] = '\0';
+        return length;
+    }
 
-        uint32_t port_index;
-        if (rdm::discovery::StateMachine::IsFinished(port_index, is_incremental)) {
-            assert(port_index_ == port_index);
-            printf("Finished:%u\n", port_index_);
-            rdm::discovery::Finished(port_index_, is_incremental ? rdm::discovery::Type::kIncremental : rdm::discovery::Type::kFull);
+    const rdm::discovery::Counters& GetCounters(uint32_t port_index) const {
+        assert(port_index < kPorts);
+        return state_machine_[port_index].GetCounters();
+    }
 
-            port_index_++;
-            if (port_index_ == kPorts) {
-                port_index_ = 0;
-            }
+    /**
+     * Each port runs its own discovery, the DUB and mute transactions of
+     * the ports interleave instead of one port after the other.
+     */
+    void Run() {
+        for (auto& state_machine : state_machine_) {
+            state_machine.Run();
+        }
 
-            if (waiting_ == 0) {
-                running_ = false;
-                port_index_ = 0;
-            }
+        if (__builtin_expect((!running_), 1)) {
+            return;
         }
 
-        if (waiting_ != 0) {
-            if ((Bit(port_index_) & waiting_) == Bit(port_index_)) {
-                if ((Bit(port_index_) & type_) == Bit(port_index_)) {
-                    rdm::discovery::Starting(port_index_, rdm::discovery::Type::kFull);
-                    rdm::discovery::StateMachine::Full(port_index_, &s_tod[port_index_]);
-                    printf("Full:%u\n", port_index_);
+        running_ = false;
+
+        for (uint32_t port_index = 0; port_index < kPorts; port_index++) {
+            auto& state_machine = state_machine_[port_index];
+            bool is_incremental;
+
+            if (state_machine.IsFinished(is_incremental)) {
+                printf("Finished:%u\n", port_index);
+                rdm::discovery::Finished(port_index, is_incremental ? rdm::discovery::Type::kIncremental : rdm::discovery::Type::kFull);
+            }
+
+            if (((Bit(port_index) & waiting_) == Bit(port_index)) && !state_machine.IsRunning()) {
+                if ((Bit(port_index) & type_) == Bit(port_index)) {
+                    rdm::discovery::Starting(port_index, rdm::discovery::Type::kFull);
+                    state_machine.Full(&s_tod[port_index]);
+                    printf("Full:%u\n", port_index);
                 } else {
-                    rdm::discovery::Starting(port_index_, rdm::discovery::Type::kIncremental);
-                    rdm::discovery::StateMachine::Incremental(port_index_, &s_tod[port_index_]);
-                    printf("Incremental:%u\n", port_index_);
+                    rdm::discovery::Starting(port_index, rdm::discovery::Type::kIncremental);
+                    state_machine.Incremental(&s_tod[port_index]);
+                    printf("Incremental:%u\n", port_index);
                 }
 
-                waiting_ &= static_cast<uint8_t>(~Bit(port_index_));
-            } else {
-                port_index_++;
-                if (port_index_ == kPorts) {
-                    port_index_ = 0;
-                }
+                waiting_ &= static_cast<uint8_t>(~Bit(port_index));
             }
 
-            return;
+            if (state_machine.IsRunning()) {
+                running_ = true;
+            }
         }
     }
 
@@ -227,6 +233,11 @@ class Discovery : rdm::discovery::StateMachine {
         return s_tod[port_index].UidCount();
     }
 
+    uint32_t TodGeneration(uint32_t port_index) const {
+        assert(port_index < kPorts);
+        return s_tod[port_index].Generation();
+    }
+
     bool TodCopyUidEntry(uint32_t port_index, uint32_t index, uint8_t uid[rdm::kUidSize]) {
         assert(port_index < kPorts);
         return s_tod[port_index].CopyUidEntry(index, uid);
@@ -298,7 +309,7 @@ class Discovery : rdm::discovery::StateMachine {
    private:
     static constexpr uint8_t Bit(uint32_t index) { return static_cast<uint8_t>(1U << index); }
 
-    uint8_t port_index_{0};
+    rdm::discovery::StateMachine state_machine_[kPorts];
     uint8_t enabled_{0};
     uint8_t waiting_{0};
     uint8_t type_{0};
@@ -55,27 +55,38 @@ enum class State {
 	kFinished
 };
 
+struct Counters {
+    uint32_t timeout;   ///< No response from a muted or quick found UID within kReceiveTimeOut
+    uint32_t collision; ///< DISC_UNIQUE_BRANCH responses with a bad checksum
+};
+
+/**
+ * Discovery of a single port. rdm::Discovery has one per port, their
+ * transactions interleave as each Run() only polls its own port.
+ */
 class StateMachine {
    public:
-    explicit StateMachine(const uint8_t* uid);
-
+    StateMachine() = default;
     ~StateMachine() = default;
 
-    bool Full(uint32_t port_index, rdm::Tod* tod);
-    bool Incremental(uint32_t port_index, rdm::Tod* tod);
+    StateMachine(const StateMachine&) = delete;
+    StateMachine& operator=(const StateMachine&) = delete;
+
+    void Init(uint32_t port_index, const uint8_t* uid);
+
+    bool Full(rdm::Tod* tod);
+    bool Incremental(rdm::Tod* tod);
 
     bool Stop();
 
-    bool IsRunning() { return (state_ != rdm::discovery::State::kIdle); }
+    bool IsRunning() const { return (state_ != rdm::discovery::State::kIdle); }
 
-    bool IsRunning(uint32_t& port_index, bool& is_incremental) const {
-        port_index = port_index_;
+    bool IsRunning(bool& is_incremental) const {
         is_incremental = do_incremental_;
         return (state_ != rdm::discovery::State::kIdle);
     }
 
-    bool IsFinished(uint32_t& port_index, bool& is_incremental) {
-        port_index = port_index_;
+    bool IsFinished(bool& is_incremental) {
         is_incremental = do_incremental_;
 
         if (is_finished_) {
@@ -88,6 +99,8 @@ class StateMachine {
 
     uint32_t CopyWorkingQueue(char* out_buffer, uint32_t out_buffer_size);
 
+    const rdm::discovery::Counters& GetCounters() const { return counters_; }
+
     void Run() {
         if (__builtin_expect((state_ == rdm::discovery::State::kIdle), 1)) {
             return;
@@ -98,7 +111,7 @@ class StateMachine {
 
    private:
     void Process();
-    bool Start(uint32_t port_index, rdm::Tod* tod, bool do_incremental);
+    bool Start(rdm::Tod* tod, bool do_incremental);
     bool IsValidDiscoveryResponse(uint8_t* uid);
 
     void SavedState(uint32_t line);
@@ -114,6 +127,7 @@ class StateMachine {
     bool do_incremental_{false};
     rdm::discovery::State state_{rdm::discovery::State::kIdle};
     rdm::discovery::State saved_state_{rdm::discovery::State::kIdle};
+    rdm::discovery::Counters counters_{};
 
     struct {
         uint32_t micros;
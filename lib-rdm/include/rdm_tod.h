@@ -37,22 +37,23 @@
 #include "firmware/debug/debug_debug.h"
 
 namespace rdm {
+/*
+ * The table is kept sorted on the UID (big-endian, so memcmp order is numeric order).
+ * Exist() is a binary search, ArtTodData paging walks the table in UID order, and
+ * the mute flag is stored with the entry so that it moves along on insert / delete.
+ */
 class Tod {
    public:
 #if !defined(RDM_DISCOVERY_TOD_TABLE_SIZE)
 #define RDM_DISCOVERY_TOD_TABLE_SIZE 200U
 #endif
     static constexpr uint32_t kTableSize = RDM_DISCOVERY_TOD_TABLE_SIZE;
-    static constexpr uint32_t kMutesTableSize = (kTableSize + 32) / 32;
     static constexpr uint32_t kInvalidEntry = UINT32_MAX;
 
     Tod() {
         for (uint32_t i = 0; i < kTableSize; i++) {
-            memcpy(&tod_[i], rdm::kUidAll, rdm::kUidSize);
-        }
-
-        for (uint32_t i = 0; i < kMutesTableSize; i++) {
-            mutes_[i] = 0;
+            memcpy(tod_[i].uid, rdm::kUidAll, rdm::kUidSize);
+            tod_[i].is_muted = 0;
         }
     }
 
@@ -60,14 +61,16 @@ class Tod {
 
     void Reset() {
         for (uint32_t i = 0; i < entries_; i++) {
-            memcpy(&tod_[i], rdm::kUidAll, rdm::kUidSize);
+            memcpy(tod_[i].uid, rdm::kUidAll, rdm::kUidSize);
+            tod_[i].is_muted = 0;
         }
 
-        entries_ = 0;
-
-        for (uint32_t i = 0; i < kMutesTableSize; i++) {
-            mutes_[i] = 0;
+        if (entries_ != 0) {
+            generation_++;
         }
+
+        entries_ = 0;
+        saved_index_ = kInvalidEntry;
     }
 
     bool AddUid(const uint8_t* uid) {
@@ -75,24 +78,41 @@ class Tod {
             return false;
         }
 
-        if (Exist(uid)) {
+        const auto kIndex = LowerBound(uid);
+
+        if ((kIndex < entries_) && (memcmp(tod_[kIndex].uid, uid, rdm::kUidSize) == 0)) {
             return false;
         }
 
-        memcpy(&tod_[entries_++], uid, rdm::kUidSize);
+        memmove(&tod_[kIndex + 1], &tod_[kIndex], (entries_ - kIndex) * sizeof(Entry));
+        memcpy(tod_[kIndex].uid, uid, rdm::kUidSize);
+        tod_[kIndex].is_muted = 0;
+
+        entries_++;
+        generation_++;
+
+        if ((saved_index_ != kInvalidEntry) && (saved_index_ >= kIndex)) {
+            saved_index_++;
+        }
 
         return true;
     }
 
     uint32_t UidCount() const { return entries_; }
 
+    /*
+     * Incremented on every change of the table contents.
+     * Compare with a previously read value to find out if the TOD has changed.
+     */
+    uint32_t Generation() const { return generation_; }
+
     bool CopyUidEntry(uint32_t index, uint8_t uid[rdm::kUidSize]) {
-        if (index > entries_) {
+        if (index >= entries_) {
             memcpy(uid, rdm::kUidAll, rdm::kUidSize);
             return false;
         }
 
-        memcpy(uid, &tod_[index], rdm::kUidSize);
+        memcpy(uid, tod_[index].uid, rdm::kUidSize);
         return true;
     }
 
@@ -101,50 +121,47 @@ class Tod {
         DEBUG_PRINTF("entries_=%u", static_cast<unsigned int>(entries_));
         assert(table != nullptr);
 
-        const auto* src = reinterpret_cast<const uint8_t*>(tod_);
         auto* dst = table;
 
-        for (uint32_t i = 0; i < (entries_ * rdm::kUidSize); i++) {
-            *dst++ = *src++;
+        for (uint32_t i = 0; i < entries_; i++) {
+            memcpy(dst, tod_[i].uid, rdm::kUidSize);
+            dst += rdm::kUidSize;
         }
 
         DEBUG_EXIT();
     }
 
     bool Delete(const uint8_t* uid) {
-        bool found = false;
-        uint32_t entry;
+        const auto kIndex = LowerBound(uid);
 
-        for (entry = 0; entry < entries_; entry++) {
-            if (memcmp(&tod_[entry], uid, rdm::kUidSize) == 0) {
-                found = true;
-                break;
-            }
-        }
-
-        if (!found) {
+        if ((kIndex == entries_) || (memcmp(tod_[kIndex].uid, uid, rdm::kUidSize) != 0)) {
             return false;
         }
 
-        if (entry == kTableSize - 1) {
-            memcpy(&tod_[entry], rdm::kUidAll, rdm::kUidSize);
-        } else {
-            for (; entry < entries_; entry++) {
-                memcpy(&tod_[entry], &tod_[entry + 1], rdm::kUidSize);
+        entries_--;
+        generation_++;
+
+        memmove(&tod_[kIndex], &tod_[kIndex + 1], (entries_ - kIndex) * sizeof(Entry));
+        memcpy(tod_[entries_].uid, rdm::kUidAll, rdm::kUidSize);
+        tod_[entries_].is_muted = 0;
+
+        if (saved_index_ != kInvalidEntry) {
+            if (saved_index_ == kIndex) {
+                saved_index_ = kInvalidEntry;
+            } else if (saved_index_ > kIndex) {
+                saved_index_--;
             }
         }
 
-        entries_--;
-
         return true;
     }
 
     bool Exist(const uint8_t* uid) {
-        for (uint32_t index = 0; index < entries_; index++) {
-            if (memcmp(&tod_[index], uid, rdm::kUidSize) == 0) {
-                saved_index_ = index;
-                return true;
-            }
+        const auto kIndex = LowerBound(uid);
+
+        if ((kIndex < entries_) && (memcmp(tod_[kIndex].uid, uid, rdm::kUidSize) == 0)) {
+            saved_index_ = kIndex;
+            return true;
         }
 
         saved_index_ = kInvalidEntry;
@@ -154,7 +171,7 @@ class Tod {
     const uint8_t* Next() {
         saved_index_++;
 
-        if (saved_index_ == entries_) {
+        if (saved_index_ >= entries_) {
             saved_index_ = 0;
         }
 
@@ -166,10 +183,7 @@ class Tod {
             return;
         }
 
-        const auto kIndex = saved_index_ / 32;
-        const auto kShift = saved_index_ - (kIndex * 32);
-
-        mutes_[kIndex] |= (1U << kShift);
+        tod_[saved_index_].is_muted = 1;
     }
 
     void UnMute() {
@@ -177,15 +191,12 @@ class Tod {
             return;
         }
 
-        const auto kIndex = saved_index_ / 32;
-        const auto kShift = saved_index_ - (kIndex * 32);
-
-        mutes_[kIndex] &= ~(1U << kShift);
+        tod_[saved_index_].is_muted = 0;
     }
 
     void UnMuteAll() {
-        for (uint32_t i = 0; i < kMutesTableSize; i++) {
-            mutes_[i] = 0;
+        for (uint32_t i = 0; i < entries_; i++) {
+            tod_[i].is_muted = 0;
         }
     }
 
@@ -194,11 +205,7 @@ class Tod {
             return true;
         }
 
-        const auto kIndex = saved_index_ / 32;
-        const auto kMutes = mutes_[kIndex];
-        const auto kShift = saved_index_ - (kIndex * 32);
-
-        return (kMutes & (1U << kShift)) == (1U << kShift);
+        return tod_[saved_index_].is_muted != 0;
     }
 
     void Dump([[maybe_unused]] uint32_t count) {
@@ -209,7 +216,8 @@ class Tod {
 
         printf("[%u]\n", static_cast<unsigned int>(count));
         for (uint32_t i = 0; i < count; i++) {
-            printf("%.2x%.2x:%.2x%.2x%.2x%.2x\n", tod_[i].uid[0], tod_[i].uid[1], tod_[i].uid[2], tod_[i].uid[3], tod_[i].uid[4], tod_[i].uid[5]);
+            const auto* uid = tod_[i].uid;
+            printf("%.2x%.2x:%.2x%.2x%.2x%.2x%s\n", uid[0], uid[1], uid[2], uid[3], uid[4], uid[5], tod_[i].is_muted != 0 ? " M" : "");
         }
 #endif
     }
@@ -220,14 +228,38 @@ class Tod {
 #endif
     }
 
+   private:
+    /*
+     * First index with tod_[index] >= uid, entries_ when there is none.
+     */
+    uint32_t LowerBound(const uint8_t* uid) const {
+        uint32_t first = 0;
+        uint32_t count = entries_;
+
+        while (count > 0) {
+            const auto kStep = count / 2;
+            const auto kMiddle = first + kStep;
+
+            if (memcmp(tod_[kMiddle].uid, uid, rdm::kUidSize) < 0) {
+                first = kMiddle + 1;
+                count -= kStep + 1;
+            } else {
+                count = kStep;
+            }
+        }
+
+        return first;
+    }
+
    private:
     uint32_t entries_{0};
     uint32_t saved_index_{kInvalidEntry};
-    uint32_t mutes_[kMutesTableSize];
-    struct Uid {
+    uint32_t generation_{0};
+    struct Entry {
         uint8_t uid[rdm::kUidSize];
+        uint8_t is_muted;
     };
-    Uid tod_[kTableSize];
+    Entry tod_[kTableSize];
 };
 } // namespace rdm
 
@@ -230,6 +230,20 @@ class RDMHandler
         return static_cast<uint8_t>(sizeof(struct rdmhandler::ParameterDescription) - sizeof(const char*) - sizeof(const uint8_t) + n);
     }
 
+    static constexpr bool IsSortedOnPid(const PidDefinition* table, size_t count)
+    {
+        for (size_t i = 1; i < count; i++)
+        {
+            if (table[i - 1].nPid >= table[i].nPid)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static const PidDefinition* FindPidDefinition(uint16_t pid);
+
     static const PidDefinition PID_DEFINITIONS[];
     static const PidDefinition PID_DEFINITIONS_SUB_DEVICES[];
 #if defined(CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
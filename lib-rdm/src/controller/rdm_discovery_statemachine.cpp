@@ -71,12 +71,13 @@ static void PrintUid(const uint8_t* uid) {
 #define NEW_STATE(state, late) NewState(state, late, __LINE__);
 #define SAVED_STATE() SavedState(__LINE__);
 
-StateMachine::StateMachine(const uint8_t* uid) {
+void StateMachine::Init(uint32_t port_index, const uint8_t* uid) {
+    port_index_ = port_index;
     memcpy(uid_, uid, rdm::kUidSize);
     message_.SetSrcUid(uid);
 
 #ifndef NDEBUG
-    printf("Uid : ");
+    printf("Port %u, Uid : ", port_index);
     rdm::discovery::PrintUid(uid_);
     puts("");
 #endif
@@ -107,23 +108,23 @@ uint32_t StateMachine::CopyWorkingQueue(char* out_buffer, uint32_t out_buffer_si
     return static_cast<uint32_t>(length - 1);
 }
 
-bool StateMachine::Full(uint32_t port_index, rdm::Tod* tod) {
+bool StateMachine::Full(rdm::Tod* tod) {
     RDM_DISCOVERY_DEBUG_ENTRY();
     tod->Reset();
-    const auto kStart = Start(port_index, tod, false);
+    const auto kStart = Start(tod, false);
     RDM_DISCOVERY_DEBUG_EXIT();
     return kStart;
 }
 
-bool StateMachine::Incremental(uint32_t port_index, rdm::Tod* tod) {
+bool StateMachine::Incremental(rdm::Tod* tod) {
     RDM_DISCOVERY_DEBUG_ENTRY();
     mute_.tod_entries = tod->UidCount();
-    const auto kStart = Start(port_index, tod, true);
+    const auto kStart = Start(tod, true);
     RDM_DISCOVERY_DEBUG_EXIT();
     return kStart;
 }
 
-bool StateMachine::Start(uint32_t port_index, rdm::Tod* tod, bool do_incremental) {
+bool StateMachine::Start(rdm::Tod* tod, bool do_incremental) {
     RDM_DISCOVERY_DEBUG_ENTRY();
 
     if (state_ != rdm::discovery::State::kIdle) {
@@ -132,7 +133,6 @@ bool StateMachine::Start(uint32_t port_index, rdm::Tod* tod, bool do_incremental
         return false;
     }
 
-    port_index_ = port_index;
     tod_ = tod;
 
     do_incremental_ = do_incremental;
@@ -350,6 +350,7 @@ void StateMachine::Process() {
             }
 
             if ((timing::Micros() - mute_.micros) > rdm::discovery::kReceiveTimeOut) {
+                counters_.timeout++;
                 assert(mute_.counter > 0);
                 mute_.counter--;
                 message_.Transmit(port_index_);
@@ -467,6 +468,7 @@ void StateMachine::Process() {
             }
 
             if ((timing::Micros() - discovery_single_device_.micros) > rdm::discovery::kReceiveTimeOut) {
+                counters_.timeout++;
                 assert(mute_.counter > 0);
                 discovery_single_device_.counter--;
                 message_.Transmit(port_index_);
@@ -490,6 +492,8 @@ void StateMachine::Process() {
                 return;
             }
 
+            counters_.collision++;
+
             discovery_.mid_position = ((discovery_.lower_bound & (0x0000800000000000 - 1)) + (discovery_.upper_bound & (0x0000800000000000 - 1))) / 2 + (discovery_.upper_bound & (0x0000800000000000) ? 0x0000400000000000 : 0) +
                                       (discovery_.lower_bound & (0x0000800000000000) ? 0x0000400000000000 : 0);
 
@@ -557,6 +561,7 @@ void StateMachine::Process() {
             }
 
             if ((timing::Micros() - quick_find_.micros) > rdm::discovery::kReceiveTimeOut) {
+                counters_.timeout++;
                 assert(quick_find_.counter > 0);
                 quick_find_.counter--;
                 quick_find_.is_command_running = false;
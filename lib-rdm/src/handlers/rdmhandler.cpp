@@ -63,14 +63,9 @@ enum class ResetMode : uint8_t {
     kCold = 0xFF ///< A cold reset is the equivalent of removing and reapplying power to the device.
 };
 
-const RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS[]{
-    {E120_DEVICE_INFO, &RDMHandler::GetDeviceInfo, nullptr, 0, false, true, true},
-    {E120_DEVICE_MODEL_DESCRIPTION, &RDMHandler::GetDeviceModelDescription, nullptr, 0, true, true, true},
-    {E120_MANUFACTURER_LABEL, &RDMHandler::GetManufacturerLabel, nullptr, 0, true, true, true},
-    {E120_DEVICE_LABEL, &RDMHandler::GetDeviceLabel, &RDMHandler::SetDeviceLabel, 0, true, true, true},
-    {E120_FACTORY_DEFAULTS, &RDMHandler::GetFactoryDefaults, &RDMHandler::SetFactoryDefaults, 0, true, true, true},
-    {E120_IDENTIFY_DEVICE, &RDMHandler::GetIdentifyDevice, &RDMHandler::SetIdentifyDevice, 0, false, true, true},
-    {E120_RESET_DEVICE, nullptr, &RDMHandler::SetResetDevice, 0, true, true, true},
+// The tables are sorted on PID, FindPidDefinition() does a binary search.
+
+constexpr RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS[]{
 #if defined(RDM_RESPONDER)
 #if defined(ENABLE_RDM_QUEUED_MSG)
     {E120_QUEUED_MESSAGE, &RDMHandler::GetQueuedMessage, nullptr, 1, true, false},
@@ -79,7 +74,16 @@ const RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS[]{
 #if defined(CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
     {E120_PARAMETER_DESCRIPTION, &RDMHandler::GetParameterDescription, nullptr, 2, false, true, false},
 #endif
+#endif
+    {E120_DEVICE_INFO, &RDMHandler::GetDeviceInfo, nullptr, 0, false, true, true},
+#if defined(RDM_RESPONDER)
     {E120_PRODUCT_DETAIL_ID_LIST, &RDMHandler::GetProductDetailIdList, nullptr, 0, true, true, false},
+#endif
+    {E120_DEVICE_MODEL_DESCRIPTION, &RDMHandler::GetDeviceModelDescription, nullptr, 0, true, true, true},
+    {E120_MANUFACTURER_LABEL, &RDMHandler::GetManufacturerLabel, nullptr, 0, true, true, true},
+    {E120_DEVICE_LABEL, &RDMHandler::GetDeviceLabel, &RDMHandler::SetDeviceLabel, 0, true, true, true},
+    {E120_FACTORY_DEFAULTS, &RDMHandler::GetFactoryDefaults, &RDMHandler::SetFactoryDefaults, 0, true, true, true},
+#if defined(RDM_RESPONDER)
     {E120_LANGUAGE_CAPABILITIES, &RDMHandler::GetLanguage, nullptr, 0, true, true, false},
     {E120_LANGUAGE, &RDMHandler::GetLanguage, &RDMHandler::SetLanguage, 0, true, true, false},
     {E120_SOFTWARE_VERSION_LABEL, &RDMHandler::GetSoftwareVersionLabel, nullptr, 0, false, true, false},
@@ -99,15 +103,6 @@ const RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS[]{
 #if !defined(DISABLE_RTC)
     {E120_REAL_TIME_CLOCK, &RDMHandler::GetRealTimeClock, &RDMHandler::SetRealTimeClock, 0, true, true, false},
 #endif
-	 {E120_POWER_STATE, &RDMHandler::GetPowerState, &RDMHandler::SetPowerState, 0, true, true, false},
-#if defined(CONFIG_RDM_ENABLE_SELF_TEST)
-    {E120_PERFORM_SELFTEST, &RDMHandler::GetPerformSelfTest, &RDMHandler::SetPerformSelfTest, 0, true, true, false},
-    {E120_SELF_TEST_DESCRIPTION, &RDMHandler::GetSelfTestDescription, nullptr, 1, true, true, false},
-#endif
-#if defined(ENABLE_RDM_PRESET_PLAYBACK)
-    {E120_PRESET_PLAYBACK, &RDMHandler::GetPresetPlayback, &RDMHandler::SetPresetPlayback, 0, true, true, false},
-#endif
-    {E137_1_IDENTIFY_MODE, &RDMHandler::GetIdentifyMode, &RDMHandler::SetIdentifyMode, 0, true, true, false},
 #endif
 #if defined(NODE_RDMNET_LLRP_ONLY)
     {E137_2_LIST_INTERFACES, &RDMHandler::GetInterfaceList, nullptr, 0, false, false, true},
@@ -116,27 +111,44 @@ const RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS[]{
     {E137_2_IPV4_DHCP_MODE, &RDMHandler::GetDHCPMode, &RDMHandler::SetDHCPMode, 4, false, false, true},
     {E137_2_IPV4_ZEROCONF_MODE, &RDMHandler::GetZeroconf, &RDMHandler::SetAutoIp, 4, false, false, true},
     {E137_2_IPV4_CURRENT_ADDRESS, &RDMHandler::GetAddressNetmask, nullptr, 4, false, false, true},
-    {E137_2_INTERFACE_RENEW_DHCP, nullptr, &RDMHandler::RenewDhcp, 4, false, false, true},
     {E137_2_IPV4_STATIC_ADDRESS, &RDMHandler::GetStaticAddress, &RDMHandler::SetStaticAddress, 4, false, false, true},
+    {E137_2_INTERFACE_RENEW_DHCP, nullptr, &RDMHandler::RenewDhcp, 4, false, false, true},
     {E137_2_INTERFACE_APPLY_CONFIGURATION, nullptr, &RDMHandler::ApplyConfiguration, 4, false, false, true},
-    {E137_2_DNS_IPV4_NAME_SERVER, &RDMHandler::GetNameServers, nullptr, 1, false, false, true},
     {E137_2_IPV4_DEFAULT_ROUTE, &RDMHandler::GetDefaultRoute, &RDMHandler::SetDefaultRoute, 0, false, false, true},
+    {E137_2_DNS_IPV4_NAME_SERVER, &RDMHandler::GetNameServers, nullptr, 1, false, false, true},
     {E137_2_DNS_HOSTNAME, &RDMHandler::GetHostName, &RDMHandler::SetHostName, 0, false, false, true},
-    {E137_2_DNS_DOMAIN_NAME, &RDMHandler::GetDomainName, &RDMHandler::SetDomainName, 0, false, false, true}
+    {E137_2_DNS_DOMAIN_NAME, &RDMHandler::GetDomainName, &RDMHandler::SetDomainName, 0, false, false, true},
+#endif
+    {E120_IDENTIFY_DEVICE, &RDMHandler::GetIdentifyDevice, &RDMHandler::SetIdentifyDevice, 0, false, true, true},
+    {E120_RESET_DEVICE, nullptr, &RDMHandler::SetResetDevice, 0, true, true, true},
+#if defined(RDM_RESPONDER)
+    {E120_POWER_STATE, &RDMHandler::GetPowerState, &RDMHandler::SetPowerState, 0, true, true, false},
+#if defined(CONFIG_RDM_ENABLE_SELF_TEST)
+    {E120_PERFORM_SELFTEST, &RDMHandler::GetPerformSelfTest, &RDMHandler::SetPerformSelfTest, 0, true, true, false},
+    {E120_SELF_TEST_DESCRIPTION, &RDMHandler::GetSelfTestDescription, nullptr, 1, true, true, false},
+#endif
+#if defined(ENABLE_RDM_PRESET_PLAYBACK)
+    {E120_PRESET_PLAYBACK, &RDMHandler::GetPresetPlayback, &RDMHandler::SetPresetPlayback, 0, true, true, false},
+#endif
+    {E137_1_IDENTIFY_MODE, &RDMHandler::GetIdentifyMode, &RDMHandler::SetIdentifyMode, 0, true, true, false},
 #endif
 };
 
-const RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS_SUB_DEVICES[]{
-    {E120_DEVICE_INFO, &RDMHandler::GetDeviceInfo, nullptr, 0, true, true, false},
-    {E120_SOFTWARE_VERSION_LABEL, &RDMHandler::GetSoftwareVersionLabel, nullptr, 0, true, true, false},
-    {E120_IDENTIFY_DEVICE, &RDMHandler::GetIdentifyDevice, &RDMHandler::SetIdentifyDevice, 0, true, true, false},
+constexpr RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS_SUB_DEVICES[]{
 #if defined(RDM_RESPONDER)
     {E120_SUPPORTED_PARAMETERS, &RDMHandler::GetSupportedParameters, nullptr, 0, true, true, false},
+#endif
+    {E120_DEVICE_INFO, &RDMHandler::GetDeviceInfo, nullptr, 0, true, true, false},
+#if defined(RDM_RESPONDER)
     {E120_PRODUCT_DETAIL_ID_LIST, &RDMHandler::GetProductDetailIdList, nullptr, 0, true, true, false},
+#endif
+    {E120_SOFTWARE_VERSION_LABEL, &RDMHandler::GetSoftwareVersionLabel, nullptr, 0, true, true, false},
+#if defined(RDM_RESPONDER)
     {E120_DMX_PERSONALITY, &RDMHandler::GetPersonality, &RDMHandler::SetPersonality, 0, true, true, false},
     {E120_DMX_PERSONALITY_DESCRIPTION, &RDMHandler::GetPersonalityDescription, nullptr, 1, true, true, false},
-    {E120_DMX_START_ADDRESS, &RDMHandler::GetDmxStartAddress, &RDMHandler::SetDmxStartAddress, 0, true, true, false}
+    {E120_DMX_START_ADDRESS, &RDMHandler::GetDmxStartAddress, &RDMHandler::SetDmxStartAddress, 0, true, true, false},
 #endif
+    {E120_IDENTIFY_DEVICE, &RDMHandler::GetIdentifyDevice, &RDMHandler::SetIdentifyDevice, 0, true, true, false},
 };
 
 #if defined(CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
@@ -148,6 +160,39 @@ const RDMHandler::PidDefinition RDMHandler::PID_DEFINITION_MANUFACTURER_GENERAL{
 #endif
 #endif
 
+const RDMHandler::PidDefinition* RDMHandler::FindPidDefinition(uint16_t pid)
+{
+    static_assert(IsSortedOnPid(PID_DEFINITIONS, sizeof(PID_DEFINITIONS) / sizeof(PID_DEFINITIONS[0])), "PID_DEFINITIONS must be sorted on PID");
+    static_assert(IsSortedOnPid(PID_DEFINITIONS_SUB_DEVICES, sizeof(PID_DEFINITIONS_SUB_DEVICES) / sizeof(PID_DEFINITIONS_SUB_DEVICES[0])),
+                  "PID_DEFINITIONS_SUB_DEVICES must be sorted on PID");
+
+    uint32_t first = 0;
+    uint32_t count = sizeof(PID_DEFINITIONS) / sizeof(PID_DEFINITIONS[0]);
+
+    while (count > 0)
+    {
+        const auto kStep = count / 2;
+        const auto kMiddle = first + kStep;
+
+        if (PID_DEFINITIONS[kMiddle].nPid < pid)
+        {
+            first = kMiddle + 1;
+            count -= kStep + 1;
+        }
+        else
+        {
+            count = kStep;
+        }
+    }
+
+    if ((first < sizeof(PID_DEFINITIONS) / sizeof(PID_DEFINITIONS[0])) && (PID_DEFINITIONS[first].nPid == pid))
+    {
+        return &PID_DEFINITIONS[first];
+    }
+
+    return nullptr;
+}
+
 RDMHandler::RDMHandler()
 {
     DEBUG_ENTRY();
@@ -436,19 +481,14 @@ void RDMHandler::Handlers(Type type, bool bIsBroadcast, uint8_t nCommandClass, u
         return;
     }
 
-    PidDefinition const* pid_handler = nullptr;
+    auto const* pid_handler = FindPidDefinition(nParamId);
     auto is_rdm = false;
     auto is_rdm_net = false;
 
-    for (auto& defintion : PID_DEFINITIONS)
+    if (pid_handler != nullptr)
     {
-        if (defintion.nPid == nParamId)
-        {
-            pid_handler = &defintion;
-            is_rdm = defintion.bRDM;
-            is_rdm_net = defintion.bRDMNet;
-            break;
-        }
+        is_rdm = pid_handler->bRDM;
+        is_rdm_net = pid_handler->bRDMNet;
     }
 
 #if defined(CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
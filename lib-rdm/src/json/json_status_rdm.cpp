@@ -38,14 +38,17 @@ static char ToType(uint32_t port_index, uint8_t data) {
 	return kIsSet ? 'f' : 'i';
 }
 static uint32_t PortStatus(uint8_t data[5], char* out_buffer, uint32_t out_buffer_size, uint32_t port_index) {
+	const auto& counters = rdm::Discovery::Instance().GetCounters(port_index);
     auto length = static_cast<uint32_t>(snprintf(out_buffer, out_buffer_size, 
-		"{\"port\":\"%c\",\"enabled\":\"%c\",\"waiting\":\"%c\",\"type\":\"%c\",\"bg\":\"%c\",\"running\":\"%c\"},", 
+		"{\"port\":\"%c\",\"enabled\":\"%c\",\"waiting\":\"%c\",\"type\":\"%c\",\"bg\":\"%c\",\"running\":\"%c\",\"timeout\":\"%u\",\"collision\":\"%u\"},", 
 		static_cast<char>('A' + port_index),
 		ToChar(port_index, data[0]),
 		ToChar(port_index, data[1]),
 		ToType(port_index, data[2]),
 		ToChar(port_index, data[3]),
-		ToChar(port_index, data[4])));
+		ToChar(port_index, data[4]),
+		static_cast<unsigned int>(counters.timeout),
+		static_cast<unsigned int>(counters.collision)));
 
     return length;
 }
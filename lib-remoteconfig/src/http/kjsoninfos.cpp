@@ -51,6 +51,8 @@ uint32_t RdmQueue(char*, uint32_t);
 uint32_t ShowFile(char*, uint32_t);
 uint32_t Pixel(char*, uint32_t);
 uint32_t PixelDmx(char*, uint32_t);
+uint32_t ArtNetController(char*, uint32_t);
+uint32_t E131Controller(char*, uint32_t);
 
 namespace emac {
 uint32_t Phy(char*, uint32_t);
@@ -199,6 +201,12 @@ constexpr Info kFileInfos[] = {
 #endif
 #if defined(NODE_SHOWFILE)
     ENTRY(status::ShowFile, nullptr, nullptr, "status/showfile", nullptr, "Showfile"),
+#endif
+#if defined(ARTNET_CONTROLLER)
+    ENTRY(status::ArtNetController, nullptr, nullptr, "status/artnetcontroller", nullptr, "ArtNetController"),
+#endif
+#if defined(E131_CONTROLLER)
+    ENTRY(status::E131Controller, nullptr, nullptr, "status/e131controller", nullptr, "E131Controller"),
 #endif
     // Action
     ENTRY(nullptr, action::Set, nullptr, "action", nullptr, nullptr),
@@ -199,7 +199,11 @@ void HttpDeamonHandleRequest::HandleRequest(uint32_t bytes_received, char* recei
     }
 
     if (content_size_ != 0U) {
-        network::tcp::Send(connection_handle_, content_, content_size_);
+        if (network::tcp::Send(connection_handle_, content_, content_size_) < 0) {
+            // The content was not accepted, reset rather than send a truncated reply.
+            HTTPD_DEBUG_PUTS("Content not sent");
+            network::tcp::Abort(connection_handle_);
+        }
     }
 
     // Reset request state after reply is sent.